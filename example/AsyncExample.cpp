@@ -0,0 +1,119 @@
+#include "Fastoml.hpp"
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct AppConfig {
+    std::string name;
+    std::int64_t workers = 0;
+};
+
+constexpr auto APP_NAME_REF = Fastoml::field<"name">(&AppConfig::name);
+constexpr auto APP_WORKERS_REF = Fastoml::field<"workers">(&AppConfig::workers);
+
+FASTOML_CPP_MODEL(AppConfig, APP_NAME_REF, APP_WORKERS_REF);
+
+namespace {
+
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t threadCount) {
+        for (std::size_t i = 0u; i < threadCount; ++i) {
+            threads_.emplace_back([this](std::stop_token stop) { run(stop); });
+        }
+    }
+
+    ~ThreadPool() {
+        for (auto& thread : threads_) {
+            thread.request_stop();
+        }
+        ready_.notify_all();
+    }
+
+    auto post(std::move_only_function<void()> work) -> void {
+        {
+            std::lock_guard lock(mutex_);
+            queue_.push_back(std::move(work));
+        }
+        ready_.notify_one();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable_any ready_;
+    std::deque<std::move_only_function<void()>> queue_;
+    std::vector<std::jthread> threads_;
+
+    auto run(std::stop_token stop) -> void {
+        while (true) {
+            std::move_only_function<void()> work;
+            {
+                std::unique_lock lock(mutex_);
+                if (!ready_.wait(lock, stop, [this] { return !queue_.empty(); })) {
+                    return;
+                }
+                work = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            work();
+        }
+    }
+};
+
+struct Task {
+    struct promise_type {
+        std::promise<int> exitCode;
+
+        auto get_return_object() -> Task {
+            return Task{exitCode.get_future()};
+        }
+        auto initial_suspend() noexcept -> std::suspend_never {
+            return {};
+        }
+        auto final_suspend() noexcept -> std::suspend_never {
+            return {};
+        }
+        auto return_value(int code) -> void {
+            exitCode.set_value(code);
+        }
+        auto unhandled_exception() -> void {
+            exitCode.set_exception(std::current_exception());
+        }
+    };
+
+    std::future<int> exitCode;
+};
+
+auto run(ThreadPool& pool) -> Task {
+    auto document = co_await Fastoml::parseAsync("[server]\nport = 8080\n", pool);
+    if (!document) {
+        std::cerr << "parse failed: " << document.error().message() << '\n';
+        co_return 1;
+    }
+    std::cout << "server.port: " << document->getOr<std::int64_t>("server.port", 0) << '\n';
+
+    auto config = co_await Fastoml::parseAsAsync<AppConfig>("name = \"ingest\"\nworkers = 4\n", pool);
+    if (!config) {
+        std::cerr << "decode failed: " << config.error().message() << '\n';
+        co_return 1;
+    }
+    std::cout << "name: " << config->name << ", workers: " << config->workers << '\n';
+    co_return 0;
+}
+
+} // namespace
+
+auto main() -> int {
+    ThreadPool pool(2u);
+    return run(pool).exitCode.get();
+}
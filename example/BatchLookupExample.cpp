@@ -0,0 +1,93 @@
+#include "Fastoml.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+auto main() -> int {
+    constexpr std::size_t routeCount = 64u;
+    constexpr std::size_t methodCount = 8u;
+
+    std::string toml;
+    std::vector<std::string> dotPaths;
+    for (std::size_t route = 0u; route < routeCount; ++route) {
+        for (std::size_t method = 0u; method < methodCount; ++method) {
+            const auto table = "routing.region.eu.cluster.primary.service.route" + std::to_string(route) + ".method" +
+                               std::to_string(method);
+            toml += '[' + table + "]\ntimeout = " + std::to_string(route * methodCount + method) + "\nretries = 3\n";
+            dotPaths.push_back(table + ".timeout");
+            dotPaths.push_back(table + ".retries");
+        }
+    }
+
+    auto document = Fastoml::parse(toml);
+    if (!document) {
+        std::cerr << "parse failed: " << document.error().message() << '\n';
+        return 1;
+    }
+
+    std::vector<Fastoml::CompiledPath> paths;
+    paths.reserve(dotPaths.size());
+    for (const auto& dotPath : dotPaths) {
+        auto path = Fastoml::CompiledPath::compile(dotPath);
+        if (!path) {
+            std::cerr << "invalid path: " << dotPath << '\n';
+            return 1;
+        }
+        paths.push_back(std::move(*path));
+    }
+
+    auto pathSet = Fastoml::CompiledPathSet::compile(paths);
+    if (!pathSet) {
+        std::cerr << "path set failed: " << pathSet.error().message() << '\n';
+        return 1;
+    }
+
+    constexpr int rounds = 200;
+    std::vector<Fastoml::NodeView> nodes(paths.size());
+    std::size_t checksum = 0u;
+
+    const auto loopStart = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (const auto& dotPath : dotPaths) {
+            checksum += document->get(dotPath).has_value() ? 1u : 0u;
+        }
+    }
+    const auto loopTime = std::chrono::steady_clock::now() - loopStart;
+
+    const auto compiledStart = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (const auto& path : paths) {
+            checksum += document->find(path).valid() ? 1u : 0u;
+        }
+    }
+    const auto compiledTime = std::chrono::steady_clock::now() - compiledStart;
+
+    const auto batchStart = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        auto found = document->getMany(paths, nodes);
+        checksum += found ? *found : 0u;
+    }
+    const auto batchTime = std::chrono::steady_clock::now() - batchStart;
+
+    const auto setStart = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        auto found = document->getMany(*pathSet, nodes);
+        checksum += found ? *found : 0u;
+    }
+    const auto setTime = std::chrono::steady_clock::now() - setStart;
+
+    const auto perPath = [&](auto elapsed) {
+        return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(rounds * paths.size());
+    };
+    std::cout << paths.size() << " paths, checksum " << checksum << '\n';
+    std::cout << "get() loop:          " << perPath(loopTime) << " ns/path\n";
+    std::cout << "find(compiled) loop: " << perPath(compiledTime) << " ns/path\n";
+    std::cout << "getMany(paths):      " << perPath(batchTime) << " ns/path\n";
+    std::cout << "getMany(pathSet):    " << perPath(setTime) << " ns/path (" << pathSet->stepCount()
+              << " probes per batch)\n";
+    return 0;
+}
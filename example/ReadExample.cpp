@@ -13,7 +13,7 @@ enabled = true
 
     auto document = Fastoml::parse(text);
     if (!document) {
-        std::cerr << "parse failed: " << document.error().message << '\n';
+        std::cerr << "parse failed: " << document.error().message() << '\n';
         return 1;
     }
 
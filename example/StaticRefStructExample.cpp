@@ -35,7 +35,7 @@ enabled = true
 
     auto decoded = Fastoml::parseAs<AppConfig>(input);
     if (!decoded) {
-        std::cerr << "parseAs failed: " << decoded.error().message << '\n';
+        std::cerr << "parseAs failed: " << decoded.error().message() << '\n';
         return 1;
     }
 
@@ -50,7 +50,7 @@ enabled = true
 
     auto encoded = Fastoml::toToml(*decoded);
     if (!encoded) {
-        std::cerr << "toToml failed: " << encoded.error().message << '\n';
+        std::cerr << "toToml failed: " << encoded.error().message() << '\n';
         return 1;
     }
 
@@ -5,7 +5,7 @@
 auto main() -> int {
     auto builder = Fastoml::Builder::create();
     if (!builder) {
-        std::cerr << "builder creation failed: " << builder.error().message << '\n';
+        std::cerr << "builder creation failed: " << builder.error().message() << '\n';
         return 1;
     }
 
@@ -17,7 +17,7 @@ auto main() -> int {
 
     auto server = root.table("server");
     if (!server) {
-        std::cerr << "create table failed: " << server.error().message << '\n';
+        std::cerr << "create table failed: " << server.error().message() << '\n';
         return 1;
     }
 
@@ -40,7 +40,7 @@ auto main() -> int {
 
     auto output = builder->toToml();
     if (!output) {
-        std::cerr << "serialize failed: " << output.error().message << '\n';
+        std::cerr << "serialize failed: " << output.error().message() << '\n';
         return 1;
     }
 
@@ -0,0 +1,34 @@
+#include "Fastoml.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Input layout: the first line is a dot path, the remainder is the TOML document.
+extern "C" auto LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) -> int {
+    const std::string_view input(reinterpret_cast<const char*>(data), size);
+    const auto newline = input.find('\n');
+    if (newline == std::string_view::npos) {
+        return 0;
+    }
+
+    const auto path = input.substr(0u, newline);
+    auto document = Fastoml::parse(input.substr(newline + 1u));
+    if (!document) {
+        return 0;
+    }
+
+    auto node = document->get(path);
+    const auto found = document->find(path);
+    if (node.has_value() != found.valid()) {
+        __builtin_trap();
+    }
+    if (node && node->raw() != found.raw()) {
+        __builtin_trap();
+    }
+    if (node) {
+        (void)node->location();
+        (void)node->tryAs<std::string_view>();
+    }
+    return 0;
+}
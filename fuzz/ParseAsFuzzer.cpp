@@ -0,0 +1,66 @@
+#include "Fastoml.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+struct FuzzLimits {
+    std::int64_t count = 0;
+    std::optional<double> ratio;
+};
+
+struct FuzzConfig {
+    std::string name;
+    std::int32_t port = 0;
+    bool enabled = false;
+    FuzzLimits limits;
+};
+
+constexpr auto LIMITS_COUNT_REF = Fastoml::field<"count">(&FuzzLimits::count);
+constexpr auto LIMITS_RATIO_REF = Fastoml::field<"ratio">(&FuzzLimits::ratio);
+constexpr auto CONFIG_NAME_REF = Fastoml::field<"name">(&FuzzConfig::name);
+constexpr auto CONFIG_PORT_REF = Fastoml::field<"port">(&FuzzConfig::port);
+constexpr auto CONFIG_ENABLED_REF = Fastoml::field<"enabled">(&FuzzConfig::enabled);
+constexpr auto CONFIG_LIMITS_REF = Fastoml::field<"limits">(&FuzzConfig::limits);
+
+FASTOML_CPP_MODEL(FuzzLimits, LIMITS_COUNT_REF, LIMITS_RATIO_REF);
+FASTOML_CPP_MODEL(FuzzConfig, CONFIG_NAME_REF, CONFIG_PORT_REF, CONFIG_ENABLED_REF, CONFIG_LIMITS_REF);
+
+extern "C" auto LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) -> int {
+    const std::string_view input(reinterpret_cast<const char*>(data), size);
+
+    auto document = Fastoml::parse(input);
+    if (!document) {
+        return 0;
+    }
+
+    auto config = Fastoml::decode<FuzzConfig>(*document);
+    auto violations = Fastoml::checkSchema<FuzzConfig>(*document);
+    if (!violations || config.has_value() != violations->empty()) {
+        __builtin_trap();
+    }
+    if (!config) {
+        return 0;
+    }
+
+    auto toml = Fastoml::toToml(*config);
+    if (!toml) {
+        return 0;
+    }
+    auto reparsed = Fastoml::parseAs<FuzzConfig>(*toml);
+    if (!reparsed) {
+        __builtin_trap();
+    }
+
+    const auto sameRatio = config->limits.ratio.has_value() == reparsed->limits.ratio.has_value() &&
+                           (!config->limits.ratio || std::isnan(*config->limits.ratio) ||
+                            *config->limits.ratio == *reparsed->limits.ratio);
+    if (reparsed->name != config->name || reparsed->port != config->port || reparsed->enabled != config->enabled ||
+        reparsed->limits.count != config->limits.count || !sameRatio) {
+        __builtin_trap();
+    }
+    return 0;
+}
@@ -0,0 +1,24 @@
+#include "Fastoml.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+extern "C" auto LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) -> int {
+    const std::string_view input(reinterpret_cast<const char*>(data), size);
+
+    auto document = Fastoml::parse(input);
+    auto validated = Fastoml::validate(input);
+    if (document.has_value() != validated.has_value()) {
+        __builtin_trap();
+    }
+    if (!document) {
+        return 0;
+    }
+
+    auto stats = document->stats();
+    if (!stats) {
+        __builtin_trap();
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include "Fastoml.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+extern "C" auto LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) -> int {
+    const std::string_view input(reinterpret_cast<const char*>(data), size);
+
+    auto document = Fastoml::parse(input);
+    if (!document) {
+        return 0;
+    }
+    auto rootNode = document->root();
+    if (!rootNode) {
+        __builtin_trap();
+    }
+
+    auto builder = Fastoml::Builder::create();
+    if (!builder) {
+        return 0;
+    }
+
+    auto root = builder->root();
+    for (std::size_t i = 0u; i < rootNode->size(); ++i) {
+        auto key = rootNode->keyAt(i);
+        auto value = rootNode->at(i);
+        if (!key || !value) {
+            __builtin_trap();
+        }
+        if (!root.set(*key, *value)) {
+            // Date and time kinds cannot be copied into a builder.
+            return 0;
+        }
+    }
+
+    auto toml = builder->toToml();
+    if (!toml) {
+        return 0;
+    }
+
+    auto reparsed = Fastoml::parse(*toml);
+    if (!reparsed) {
+        __builtin_trap();
+    }
+    auto reparsedRoot = reparsed->root();
+    if (!reparsedRoot || !Fastoml::equivalent(*rootNode, *reparsedRoot)) {
+        __builtin_trap();
+    }
+
+    auto finished = builder->finish();
+    if (!finished || finished->source() != reparsed->source()) {
+        __builtin_trap();
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "Fastoml.hpp"
+#include "TreeCompare.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// The SIMD and scalar parser paths must agree on validity, error position and the resulting tree.
+extern "C" auto LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) -> int {
+    const std::string_view input(reinterpret_cast<const char*>(data), size);
+
+    Fastoml::ParseOptions scalarOptions;
+    scalarOptions.disableSimd = true;
+
+    auto simd = Fastoml::parse(input);
+    auto scalar = Fastoml::parse(input, scalarOptions);
+    if (simd.has_value() != scalar.has_value()) {
+        __builtin_trap();
+    }
+
+    if (!simd) {
+        if (simd.error().code != scalar.error().code || simd.error().byteOffset != scalar.error().byteOffset) {
+            __builtin_trap();
+        }
+        return 0;
+    }
+
+    auto simdRoot = simd->root();
+    auto scalarRoot = scalar->root();
+    if (!simdRoot || !scalarRoot || !FuzzSupport::identicalTrees(*simdRoot, *scalarRoot)) {
+        __builtin_trap();
+    }
+    return 0;
+}
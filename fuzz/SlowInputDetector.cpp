@@ -0,0 +1,288 @@
+#include "Fastoml.hpp"
+#include "TreeCompare.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// Each family scales one pathological dimension; time per byte should stay flat as `scale` doubles.
+struct Family {
+    const char* name;
+    std::function<std::string(std::size_t scale)> generate;
+};
+
+auto nestedArrays(std::size_t scale) -> std::string {
+    constexpr std::size_t depth = 240u;
+    std::string out;
+    for (std::size_t i = 0u; i < scale; ++i) {
+        out += "k" + std::to_string(i) + " = ";
+        out.append(depth, '[');
+        out.append(depth, ']');
+        out += '\n';
+    }
+    return out;
+}
+
+auto nestedInlineTables(std::size_t scale) -> std::string {
+    constexpr std::size_t depth = 240u;
+    std::string out;
+    for (std::size_t i = 0u; i < scale; ++i) {
+        out += "k" + std::to_string(i) + " = ";
+        for (std::size_t d = 0u; d < depth; ++d) {
+            out += "{ a = ";
+        }
+        out += '1';
+        out.append(depth, '}');
+        out += '\n';
+    }
+    return out;
+}
+
+auto wideInlineTable(std::size_t scale) -> std::string {
+    std::string out = "t = { ";
+    for (std::size_t i = 0u; i < scale * 64u; ++i) {
+        if (i != 0u) {
+            out += ", ";
+        }
+        out += "k" + std::to_string(i) + " = " + std::to_string(i);
+    }
+    out += " }\n";
+    return out;
+}
+
+auto longEscapes(std::size_t scale) -> std::string {
+    std::string out = "s = \"";
+    for (std::size_t i = 0u; i < scale * 256u; ++i) {
+        out += "\\u0041\\n\\t\\\"";
+    }
+    out += "\"\n";
+    return out;
+}
+
+auto longDottedKey(std::size_t scale) -> std::string {
+    std::string out;
+    for (std::size_t i = 0u; i < scale * 64u; ++i) {
+        out += i == 0u ? "a" : ".a";
+    }
+    out += " = 1\n";
+    return out;
+}
+
+auto manyTableHeaders(std::size_t scale) -> std::string {
+    std::string out;
+    for (std::size_t i = 0u; i < scale * 64u; ++i) {
+        out += "[t" + std::to_string(i) + "]\nv = " + std::to_string(i) + '\n';
+    }
+    return out;
+}
+
+auto manyArrayTables(std::size_t scale) -> std::string {
+    std::string out;
+    for (std::size_t i = 0u; i < scale * 64u; ++i) {
+        out += "[[items]]\nv = " + std::to_string(i) + '\n';
+    }
+    return out;
+}
+
+auto flatBaseline(std::size_t scale) -> std::string {
+    std::string out;
+    for (std::size_t i = 0u; i < scale * 64u; ++i) {
+        out += "key" + std::to_string(i) + " = \"value\"\n";
+    }
+    return out;
+}
+
+const std::vector<Family> families = {
+    {"flat-baseline", flatBaseline},
+    {"nested-arrays", nestedArrays},
+    {"nested-inline-tables", nestedInlineTables},
+    {"wide-inline-table", wideInlineTable},
+    {"long-escapes", longEscapes},
+    {"long-dotted-key", longDottedKey},
+    {"many-table-headers", manyTableHeaders},
+    {"many-array-tables", manyArrayTables},
+};
+
+struct Options {
+    double threshold = 1.3;
+    std::size_t repeats = 5u;
+    std::size_t steps = 5u;
+    bool simdCompare = false;
+    std::filesystem::path corpusDir;
+    std::vector<std::filesystem::path> files;
+};
+
+auto bestParseNanos(std::string_view input, std::size_t repeats, Fastoml::ParseOptions parseOptions = {})
+    -> double {
+    auto best = std::chrono::nanoseconds::max();
+    for (std::size_t i = 0u; i < repeats; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        auto document = Fastoml::parse(input, parseOptions);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        (void)document;
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+    }
+    return static_cast<double>(best.count());
+}
+
+auto readInput(const std::filesystem::path& path) -> std::string {
+    std::ifstream file(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+// Fits the growth exponent between the smallest and largest run: 1.0 is linear.
+auto checkFamily(const Family& family, const Options& options) -> bool {
+    std::size_t firstBytes = 0u;
+    double firstNanos = 0.0;
+    std::size_t lastBytes = 0u;
+    double lastNanos = 0.0;
+
+    for (std::size_t step = 0u; step < options.steps; ++step) {
+        const auto input = family.generate(std::size_t{1u} << step);
+        const auto nanos = bestParseNanos(input, options.repeats);
+        std::cout << "  " << family.name << " bytes=" << input.size() << " ns/byte=" << nanos / input.size() << '\n';
+
+        if (step == 0u) {
+            firstBytes = input.size();
+            firstNanos = nanos;
+        }
+        lastBytes = input.size();
+        lastNanos = nanos;
+    }
+
+    const auto exponent = std::log(lastNanos / firstNanos) / std::log(static_cast<double>(lastBytes) / firstBytes);
+    const auto slow = exponent > options.threshold;
+    std::cout << (slow ? "SLOW " : "ok   ") << family.name << " growth exponent " << exponent << '\n';
+    return !slow;
+}
+
+// Compares a file's parse throughput against the flat baseline of the same size.
+auto checkFile(const std::filesystem::path& path, const Options& options) -> bool {
+    const auto input = readInput(path);
+    if (input.empty()) {
+        std::cerr << "cannot read " << path << '\n';
+        return false;
+    }
+
+    std::string baseline;
+    for (std::size_t scale = 1u; baseline.size() < input.size(); scale *= 2u) {
+        baseline = flatBaseline(scale);
+    }
+
+    const auto nanosPerByte = bestParseNanos(input, options.repeats) / input.size();
+    const auto baselinePerByte = bestParseNanos(baseline, options.repeats) / baseline.size();
+    const auto ratio = nanosPerByte / baselinePerByte;
+    const auto slow = ratio > options.threshold * 4.0;
+    std::cout << (slow ? "SLOW " : "ok   ") << path.string() << " ns/byte=" << nanosPerByte << " (" << ratio
+              << "x baseline)\n";
+    return !slow;
+}
+
+// Parses one input with SIMD on and off, reporting the speedup and whether both trees match.
+auto compareSimd(std::string_view name, std::string_view input, const Options& options) -> bool {
+    Fastoml::ParseOptions scalarOptions;
+    scalarOptions.disableSimd = true;
+
+    auto simd = Fastoml::parse(input);
+    auto scalar = Fastoml::parse(input, scalarOptions);
+    auto same = simd.has_value() == scalar.has_value();
+    if (same && simd) {
+        auto simdRoot = simd->root();
+        auto scalarRoot = scalar->root();
+        same = simdRoot && scalarRoot && FuzzSupport::identicalTrees(*simdRoot, *scalarRoot);
+    } else if (same) {
+        same = simd.error().code == scalar.error().code && simd.error().byteOffset == scalar.error().byteOffset;
+    }
+
+    const auto simdNanos = bestParseNanos(input, options.repeats);
+    const auto scalarNanos = bestParseNanos(input, options.repeats, scalarOptions);
+    std::cout << (same ? "ok   " : "DIFF ") << name << " bytes=" << input.size()
+              << " simd ns/byte=" << simdNanos / input.size() << " scalar ns/byte=" << scalarNanos / input.size()
+              << " speedup=" << scalarNanos / simdNanos << '\n';
+    return same;
+}
+
+auto writeCorpus(const std::filesystem::path& directory) -> void {
+    std::filesystem::create_directories(directory);
+    for (const auto& family : families) {
+        std::ofstream(directory / (std::string(family.name) + ".toml"), std::ios::binary) << family.generate(4u);
+    }
+}
+
+auto parseArguments(int argc, char** argv, Options& options) -> bool {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view argument = argv[i];
+        if (argument == "--threshold" && i + 1 < argc) {
+            options.threshold = std::stod(argv[++i]);
+        } else if (argument == "--repeats" && i + 1 < argc) {
+            options.repeats = std::stoul(argv[++i]);
+        } else if (argument == "--steps" && i + 1 < argc) {
+            options.steps = std::max<std::size_t>(2u, std::stoul(argv[++i]));
+        } else if (argument == "--simd-compare") {
+            options.simdCompare = true;
+        } else if (argument == "--write-corpus" && i + 1 < argc) {
+            options.corpusDir = argv[++i];
+        } else if (argument.starts_with("--")) {
+            return false;
+        } else {
+            options.files.emplace_back(argument);
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+    Options options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cerr << "usage: SlowInputDetector [--threshold N] [--repeats N] [--steps N] [--simd-compare] "
+                     "[--write-corpus DIR] [files...]\n";
+        return 2;
+    }
+
+    if (!options.corpusDir.empty()) {
+        writeCorpus(options.corpusDir);
+        return 0;
+    }
+
+    const auto info = Fastoml::runtimeInfo();
+    std::cout << "simd: host=" << Fastoml::simdPathName(info.hostPath) << " (fastoml's dispatch is not reported)\n";
+
+    if (options.simdCompare) {
+        bool allSame = true;
+        if (options.files.empty()) {
+            for (const auto& family : families) {
+                allSame &= compareSimd(family.name, family.generate(std::size_t{1u} << (options.steps - 1u)), options);
+            }
+        }
+        for (const auto& file : options.files) {
+            allSame &= compareSimd(file.string(), readInput(file), options);
+        }
+        return allSame ? 0 : 1;
+    }
+
+    bool allLinear = true;
+    if (options.files.empty()) {
+        for (const auto& family : families) {
+            allLinear &= checkFamily(family, options);
+        }
+    } else {
+        for (const auto& file : options.files) {
+            allLinear &= checkFile(file, options);
+        }
+    }
+    return allLinear ? 0 : 1;
+}
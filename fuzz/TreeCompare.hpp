@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Fastoml.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace FuzzSupport {
+
+// Strict structural comparison for parser parity: same kinds, same keys in the same order and bit-identical
+// scalars. Unlike Fastoml::equivalent it treats key order and float bits as significant.
+inline auto identicalTrees(const Fastoml::NodeView& left, const Fastoml::NodeView& right) -> bool {
+    if (left.valid() != right.valid() || left.kind() != right.kind()) {
+        return false;
+    }
+
+    switch (left.kind()) {
+    case Fastoml::NodeKind::Table:
+    case Fastoml::NodeKind::Array: {
+        const auto count = left.size();
+        if (count != right.size()) {
+            return false;
+        }
+        const bool table = left.kind() == Fastoml::NodeKind::Table;
+        for (std::size_t i = 0u; i < count; ++i) {
+            if (table) {
+                const auto leftKey = left.keyAt(i);
+                const auto rightKey = right.keyAt(i);
+                if (!leftKey || !rightKey || *leftKey != *rightKey) {
+                    return false;
+                }
+            }
+            const auto leftValue = left.at(i);
+            const auto rightValue = right.at(i);
+            if (!leftValue || !rightValue || !identicalTrees(*leftValue, *rightValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    case Fastoml::NodeKind::Int:
+        return left.tryAs<std::int64_t>() == right.tryAs<std::int64_t>();
+    case Fastoml::NodeKind::Float: {
+        const auto leftValue = left.tryAs<double>();
+        const auto rightValue = right.tryAs<double>();
+        return leftValue.has_value() && rightValue.has_value() &&
+               std::bit_cast<std::uint64_t>(*leftValue) == std::bit_cast<std::uint64_t>(*rightValue);
+    }
+    case Fastoml::NodeKind::Bool:
+        return left.tryAs<bool>() == right.tryAs<bool>();
+    default:
+        return left.tryAs<std::string_view>() == right.tryAs<std::string_view>();
+    }
+}
+
+} // namespace FuzzSupport
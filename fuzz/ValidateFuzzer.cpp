@@ -0,0 +1,17 @@
+#include "Fastoml.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+extern "C" auto LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) -> int {
+    const std::string_view input(reinterpret_cast<const char*>(data), size);
+
+    Fastoml::ParseOptions options;
+    options.maxDepth = 32u;
+    (void)Fastoml::validate(input, options);
+
+    options.trustUtf8 = true;
+    (void)Fastoml::validate(input, options);
+    return 0;
+}
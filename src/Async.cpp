@@ -0,0 +1,34 @@
+#include "Async.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <system_error>
+
+namespace Fastoml::detail {
+
+auto readFile(const std::filesystem::path& path) -> Result<std::string> {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return makeUnexpected<std::string>(Error{ErrorCode::Io, "Failed to open TOML file."});
+    }
+
+    std::string text;
+    std::error_code sizeError;
+    const auto size = std::filesystem::file_size(path, sizeError);
+    if (!sizeError) {
+        text.resize(static_cast<std::size_t>(size));
+        file.read(text.data(), static_cast<std::streamsize>(text.size()));
+        text.resize(static_cast<std::size_t>(file.gcount()));
+    }
+    if (file.eof()) {
+        file.clear();
+    }
+    text.append(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    if (file.bad()) {
+        return makeUnexpected<std::string>(Error{ErrorCode::Io, "Failed to read TOML file."});
+    }
+    return text;
+}
+
+} // namespace Fastoml::detail
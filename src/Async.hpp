@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Document.hpp"
+#include "StructConvert.hpp"
+
+#include <coroutine>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Fastoml {
+
+template <typename S>
+concept Scheduler = requires(S& scheduler, std::move_only_function<void()> work) { scheduler.post(std::move(work)); };
+
+using ReadCompletion = std::move_only_function<void(Result<std::string>)>;
+
+template <typename R>
+concept FileReader = requires(R& reader, std::filesystem::path path, ReadCompletion done) {
+    reader.read(std::move(path), std::move(done));
+};
+
+namespace detail {
+
+[[nodiscard]] auto readFile(const std::filesystem::path& path) -> Result<std::string>;
+
+} // namespace detail
+
+template <typename T>
+class [[nodiscard]] AsyncResult {
+public:
+    using Completion = std::move_only_function<void(Result<T>)>;
+    using Launch = std::move_only_function<void(Completion)>;
+
+    explicit AsyncResult(Launch launch) noexcept : launch_(std::move(launch)) {
+    }
+
+    AsyncResult(AsyncResult&&) noexcept = default;
+    auto operator=(AsyncResult&&) noexcept -> AsyncResult& = default;
+
+    AsyncResult(const AsyncResult&) = delete;
+    auto operator=(const AsyncResult&) -> AsyncResult& = delete;
+
+    [[nodiscard]] auto await_ready() const noexcept -> bool {
+        return false;
+    }
+
+    auto await_suspend(std::coroutine_handle<> awaiting) -> void {
+        // The completion may resume (and destroy) this awaiter before post() returns.
+        auto launch = std::move(launch_);
+        launch([this, awaiting](Result<T> result) mutable {
+            result_.emplace(std::move(result));
+            awaiting.resume();
+        });
+    }
+
+    [[nodiscard]] auto await_resume() -> Result<T> {
+        return std::move(*result_);
+    }
+
+private:
+    Launch launch_;
+    std::optional<Result<T>> result_;
+};
+
+template <Scheduler S>
+[[nodiscard]] auto parseAsync(std::string toml, S& scheduler, ParseOptions options = {}) -> AsyncResult<Document> {
+    return AsyncResult<Document>([&scheduler, toml = std::move(toml), options](auto complete) mutable {
+        scheduler.post([toml = std::move(toml), options, complete = std::move(complete)]() mutable {
+            complete(parse(toml, options));
+        });
+    });
+}
+
+namespace detail {
+
+template <typename Read, Scheduler Cpu>
+[[nodiscard]] auto parseFileWith(std::filesystem::path path, Read read, Cpu& cpu, ParseOptions options)
+    -> AsyncResult<Document> {
+    return AsyncResult<Document>(
+        [read = std::move(read), &cpu, path = std::move(path), options](auto complete) mutable {
+            read(std::move(path), [&cpu, options, complete = std::move(complete)](Result<std::string> text) mutable {
+                if (!text) {
+                    complete(makeUnexpected<Document>(text.error()));
+                    return;
+                }
+                cpu.post([text = std::move(*text), options, complete = std::move(complete)]() mutable {
+                    complete(parse(text, options));
+                });
+            });
+        });
+}
+
+} // namespace detail
+
+template <FileReader Reader, Scheduler Cpu>
+[[nodiscard]] auto parseFileAsync(std::filesystem::path path, Reader& reader, Cpu& cpu, ParseOptions options = {})
+    -> AsyncResult<Document> {
+    return detail::parseFileWith(
+        std::move(path),
+        [&reader](std::filesystem::path target, ReadCompletion done) {
+            reader.read(std::move(target), std::move(done));
+        },
+        cpu, options);
+}
+
+template <Scheduler Io, Scheduler Cpu>
+[[nodiscard]] auto parseFileAsync(std::filesystem::path path, Io& io, Cpu& cpu, ParseOptions options = {})
+    -> AsyncResult<Document>
+    requires(!FileReader<Io>)
+{
+    // Without a FileReader the file is read with blocking calls on a task posted to `io`.
+    return detail::parseFileWith(
+        std::move(path),
+        [&io](std::filesystem::path target, ReadCompletion done) {
+            io.post([target = std::move(target), done = std::move(done)]() mutable {
+                done(detail::readFile(target));
+            });
+        },
+        cpu, options);
+}
+
+template <Scheduler S>
+[[nodiscard]] auto parseFileAsync(std::filesystem::path path, S& scheduler, ParseOptions options = {})
+    -> AsyncResult<Document> {
+    return parseFileAsync(std::move(path), scheduler, scheduler, options);
+}
+
+template <typename T, Scheduler S>
+[[nodiscard]] auto parseAsAsync(std::string toml, S& scheduler, ParseOptions options = {}) -> AsyncResult<T>
+    requires ModelDefined<std::remove_cv_t<std::remove_reference_t<T>>>
+{
+    return AsyncResult<T>([&scheduler, toml = std::move(toml), options](auto complete) mutable {
+        scheduler.post([toml = std::move(toml), options, complete = std::move(complete)]() mutable {
+            complete(parseAs<T>(toml, options));
+        });
+    });
+}
+
+} // namespace Fastoml
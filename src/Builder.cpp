@@ -1,34 +1,127 @@
 #include "Builder.hpp"
 
+#include "Instrumentation.hpp"
 #include "detail/CInterop.hpp"
 
 #include <cstring>
 #include <fastoml.h>
 #include <memory>
+#include <random>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 namespace Fastoml {
 
+namespace {
+
+// Swaps each quoted temporal placeholder written by NodeBuilder for the original date/time text.
+template <typename Text>
+auto restoreTemporals(Text& output, std::string_view tag, const std::vector<std::string>& temporals) -> void {
+    if (temporals.empty()) {
+        return;
+    }
+
+    const std::string_view text(output.data(), output.size());
+    std::string restored;
+    restored.reserve(text.size());
+    std::size_t from = 0u;
+    while (true) {
+        const auto open = text.find(tag, from);
+        if (open == std::string_view::npos) {
+            break;
+        }
+
+        auto end = open + tag.size();
+        std::size_t index = 0u;
+        while (end < text.size() && text[end] >= '0' && text[end] <= '9') {
+            index = index * 10u + static_cast<std::size_t>(text[end] - '0');
+            ++end;
+        }
+        if (open <= from || text[open - 1u] != '"' || end == open + tag.size() || end >= text.size() ||
+            text[end] != '"' || index >= temporals.size()) {
+            restored.append(text.substr(from, open + tag.size() - from));
+            from = open + tag.size();
+            continue;
+        }
+
+        restored.append(text.substr(from, open - 1u - from));
+        restored += temporals[index];
+        from = end + 1u;
+    }
+    restored.append(text.substr(from));
+    output.assign(restored.data(), restored.size());
+}
+
+template <typename Text>
+auto serializeValue(const fastoml_value* rootValue, SerializeOptions options, std::string_view temporalTag,
+                    const std::vector<std::string>& temporals, Text& output) -> Result<void> {
+    FASTOML_CPP_INSTRUMENT(Operation::Serialize, 0u);
+
+    const auto fastOptions = detail::toFastomlSerializeOptions(options);
+
+    std::size_t textLength = 0u;
+    auto status = fastoml_serialize_to_buffer(rootValue, &fastOptions, nullptr, 0u, &textLength);
+    if (status != FASTOML_OK) {
+        return makeUnexpected<void>(detail::toError(status, nullptr, "Failed to estimate serialized TOML size"));
+    }
+
+    output.resize(textLength + 1u);
+    status = fastoml_serialize_to_buffer(rootValue, &fastOptions, output.data(), output.size(), &textLength);
+    if (status != FASTOML_OK) {
+        output.clear();
+        return makeUnexpected<void>(detail::toError(status, nullptr, "Failed to serialize TOML document"));
+    }
+
+    output.resize(textLength);
+    restoreTemporals(output, temporalTag, temporals);
+    FASTOML_CPP_INSTRUMENT_BYTES(output.size());
+    return {};
+}
+
+// A random tag keeps ordinary string values from being mistaken for temporal placeholders.
+auto temporalTag() -> std::string {
+    std::random_device device;
+    const auto nonce = (static_cast<std::uint64_t>(device()) << 32u) | static_cast<std::uint64_t>(device());
+    constexpr std::string_view digits = "0123456789abcdef";
+    std::string tag = "fastoml-cpp-temporal-";
+    for (auto shift = 60; shift >= 0; shift -= 4) {
+        tag += digits[(nonce >> static_cast<unsigned>(shift)) & 0xfu];
+    }
+    tag += '-';
+    return tag;
+}
+
+} // namespace
+
 struct NodeBuilder::Context {
     std::unique_ptr<fastoml_builder, decltype(&fastoml_builder_destroy)> builder{nullptr, &fastoml_builder_destroy};
+    BuilderOptions options;
+    std::uint64_t generation = 0u;
+    // fastoml's builder has no date/time values, so they are stored as strings holding this tag and an index into
+    // `temporals`, and serialization splices the original text back in.
+    std::string temporalTag;
+    std::vector<std::string> temporals;
 };
 
 struct Builder::Impl {
     std::shared_ptr<NodeBuilder::Context> context;
 };
 
-NodeBuilder::NodeBuilder(std::weak_ptr<Context> context, fastoml_value* value) noexcept
-    : context_(std::move(context)), value_(value) {
+NodeBuilder::NodeBuilder(std::weak_ptr<Context> context, std::uint64_t generation, fastoml_value* value) noexcept
+    : context_(std::move(context)), generation_(generation), value_(value) {
 }
 
 auto NodeBuilder::valid() const noexcept -> bool {
     const auto context = context_.lock();
-    return context != nullptr && context->builder != nullptr && value_ != nullptr;
+    return context != nullptr && context->builder != nullptr && value_ != nullptr &&
+           context->generation == generation_;
 }
 
 auto NodeBuilder::setValue(std::string_view key, fastoml_value* value) -> Result<NodeBuilder> {
+    FASTOML_CPP_INSTRUMENT(Operation::BuilderInsert, key.size());
+
     if (!valid()) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
@@ -49,10 +142,12 @@ auto NodeBuilder::setValue(std::string_view key, fastoml_value* value) -> Result
     if (status != FASTOML_OK) {
         return makeUnexpected<NodeBuilder>(detail::toError(status, nullptr, "Failed to set table value"));
     }
-    return NodeBuilder(context_, value_);
+    return NodeBuilder(context_, generation_, value_);
 }
 
 auto NodeBuilder::pushValue(fastoml_value* value) -> Result<NodeBuilder> {
+    FASTOML_CPP_INSTRUMENT(Operation::BuilderInsert, 0u);
+
     if (!valid()) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
@@ -65,12 +160,13 @@ auto NodeBuilder::pushValue(fastoml_value* value) -> Result<NodeBuilder> {
     if (status != FASTOML_OK) {
         return makeUnexpected<NodeBuilder>(detail::toError(status, nullptr, "Failed to append array value"));
     }
-    return NodeBuilder(context_, value_);
+    return NodeBuilder(context_, generation_, value_);
 }
 
 auto NodeBuilder::set(std::string_view key, bool value) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
     auto* entry = fastoml_builder_new_bool(context->builder.get(), value ? 1 : 0);
@@ -79,7 +175,8 @@ auto NodeBuilder::set(std::string_view key, bool value) -> Result<NodeBuilder> {
 
 auto NodeBuilder::set(std::string_view key, std::int64_t value) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
     auto* entry = fastoml_builder_new_int(context->builder.get(), value);
@@ -88,7 +185,8 @@ auto NodeBuilder::set(std::string_view key, std::int64_t value) -> Result<NodeBu
 
 auto NodeBuilder::set(std::string_view key, double value) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
     auto* entry = fastoml_builder_new_float(context->builder.get(), value);
@@ -97,7 +195,8 @@ auto NodeBuilder::set(std::string_view key, double value) -> Result<NodeBuilder>
 
 auto NodeBuilder::set(std::string_view key, std::string_view value) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
 
@@ -118,9 +217,67 @@ auto NodeBuilder::set(std::string_view key, const char* value) -> Result<NodeBui
     return set(key, std::string_view(value, std::strlen(value)));
 }
 
+auto NodeBuilder::set(std::string_view key, const NodeView& value) -> Result<NodeBuilder> {
+    switch (value.kind()) {
+    case NodeKind::Table:
+    case NodeKind::Array: {
+        auto child = value.kind() == NodeKind::Table ? table(key) : array(key);
+        if (!child) {
+            return makeUnexpected<NodeBuilder>(child.error());
+        }
+        auto copyStatus = child->copyChildren(value);
+        if (!copyStatus) {
+            return makeUnexpected<NodeBuilder>(copyStatus.error());
+        }
+        return NodeBuilder(context_, generation_, value_);
+    }
+    case NodeKind::String: {
+        auto text = value.asStringView();
+        if (!text) {
+            return makeUnexpected<NodeBuilder>(text.error());
+        }
+        return set(key, *text);
+    }
+    case NodeKind::Int: {
+        auto number = value.asInt64();
+        if (!number) {
+            return makeUnexpected<NodeBuilder>(number.error());
+        }
+        return set(key, *number);
+    }
+    case NodeKind::Float: {
+        auto number = value.asDouble();
+        if (!number) {
+            return makeUnexpected<NodeBuilder>(number.error());
+        }
+        return set(key, *number);
+    }
+    case NodeKind::Bool: {
+        auto flag = value.asBool();
+        if (!flag) {
+            return makeUnexpected<NodeBuilder>(flag.error());
+        }
+        return set(key, *flag);
+    }
+    case NodeKind::DateTime:
+    case NodeKind::Date:
+    case NodeKind::Time: {
+        auto placeholder = temporalPlaceholder(value);
+        if (!placeholder) {
+            return makeUnexpected<NodeBuilder>(placeholder.error());
+        }
+        return set(key, std::string_view(*placeholder));
+    }
+    default:
+        return makeUnexpected<NodeBuilder>(
+            keyError(ErrorCode::UnsupportedType, "Node kind cannot be copied into a builder.", key));
+    }
+}
+
 auto NodeBuilder::table(std::string_view key) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
 
@@ -129,12 +286,13 @@ auto NodeBuilder::table(std::string_view key) -> Result<NodeBuilder> {
     if (!setResult) {
         return makeUnexpected<NodeBuilder>(setResult.error());
     }
-    return NodeBuilder(context, table);
+    return NodeBuilder(context, generation_, table);
 }
 
 auto NodeBuilder::array(std::string_view key) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
 
@@ -143,12 +301,13 @@ auto NodeBuilder::array(std::string_view key) -> Result<NodeBuilder> {
     if (!setResult) {
         return makeUnexpected<NodeBuilder>(setResult.error());
     }
-    return NodeBuilder(context, array);
+    return NodeBuilder(context, generation_, array);
 }
 
 auto NodeBuilder::push(bool value) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
     auto* entry = fastoml_builder_new_bool(context->builder.get(), value ? 1 : 0);
@@ -157,7 +316,8 @@ auto NodeBuilder::push(bool value) -> Result<NodeBuilder> {
 
 auto NodeBuilder::push(std::int64_t value) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
     auto* entry = fastoml_builder_new_int(context->builder.get(), value);
@@ -166,7 +326,8 @@ auto NodeBuilder::push(std::int64_t value) -> Result<NodeBuilder> {
 
 auto NodeBuilder::push(double value) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
     auto* entry = fastoml_builder_new_float(context->builder.get(), value);
@@ -175,7 +336,8 @@ auto NodeBuilder::push(double value) -> Result<NodeBuilder> {
 
 auto NodeBuilder::push(std::string_view value) -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
 
@@ -196,9 +358,112 @@ auto NodeBuilder::push(const char* value) -> Result<NodeBuilder> {
     return push(std::string_view(value, std::strlen(value)));
 }
 
+auto NodeBuilder::push(const NodeView& value) -> Result<NodeBuilder> {
+    switch (value.kind()) {
+    case NodeKind::Table:
+    case NodeKind::Array: {
+        auto child = value.kind() == NodeKind::Table ? pushTable() : pushArray();
+        if (!child) {
+            return makeUnexpected<NodeBuilder>(child.error());
+        }
+        auto copyStatus = child->copyChildren(value);
+        if (!copyStatus) {
+            return makeUnexpected<NodeBuilder>(copyStatus.error());
+        }
+        return NodeBuilder(context_, generation_, value_);
+    }
+    case NodeKind::String: {
+        auto text = value.asStringView();
+        if (!text) {
+            return makeUnexpected<NodeBuilder>(text.error());
+        }
+        return push(*text);
+    }
+    case NodeKind::Int: {
+        auto number = value.asInt64();
+        if (!number) {
+            return makeUnexpected<NodeBuilder>(number.error());
+        }
+        return push(*number);
+    }
+    case NodeKind::Float: {
+        auto number = value.asDouble();
+        if (!number) {
+            return makeUnexpected<NodeBuilder>(number.error());
+        }
+        return push(*number);
+    }
+    case NodeKind::Bool: {
+        auto flag = value.asBool();
+        if (!flag) {
+            return makeUnexpected<NodeBuilder>(flag.error());
+        }
+        return push(*flag);
+    }
+    case NodeKind::DateTime:
+    case NodeKind::Date:
+    case NodeKind::Time: {
+        auto placeholder = temporalPlaceholder(value);
+        if (!placeholder) {
+            return makeUnexpected<NodeBuilder>(placeholder.error());
+        }
+        return push(std::string_view(*placeholder));
+    }
+    default:
+        return makeUnexpected<NodeBuilder>(
+            Error{ErrorCode::UnsupportedType, "Node kind cannot be copied into a builder."});
+    }
+}
+
+auto NodeBuilder::copyChildren(const NodeView& source) -> Result<void> {
+    const auto count = source.size();
+    const auto isTable = source.kind() == NodeKind::Table;
+    for (std::size_t i = 0u; i < count; ++i) {
+        auto child = source.at(i);
+        if (!child) {
+            return makeUnexpected<void>(child.error());
+        }
+
+        if (isTable) {
+            auto key = source.keyAt(i);
+            if (!key) {
+                return makeUnexpected<void>(key.error());
+            }
+            auto status = set(*key, *child);
+            if (!status) {
+                return makeUnexpected<void>(status.error());
+            }
+        } else {
+            auto status = push(*child);
+            if (!status) {
+                return makeUnexpected<void>(status.error());
+            }
+        }
+    }
+    return {};
+}
+
+auto NodeBuilder::temporalPlaceholder(const NodeView& value) const -> Result<std::string> {
+    auto context = context_.lock();
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
+        return makeUnexpected<std::string>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
+    }
+
+    auto text = value.asStringView();
+    if (!text) {
+        return makeUnexpected<std::string>(text.error());
+    }
+
+    auto placeholder = context->temporalTag + std::to_string(context->temporals.size());
+    context->temporals.emplace_back(*text);
+    return placeholder;
+}
+
 auto NodeBuilder::pushTable() -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
 
@@ -207,12 +472,13 @@ auto NodeBuilder::pushTable() -> Result<NodeBuilder> {
     if (!pushResult) {
         return makeUnexpected<NodeBuilder>(pushResult.error());
     }
-    return NodeBuilder(context, table);
+    return NodeBuilder(context, generation_, table);
 }
 
 auto NodeBuilder::pushArray() -> Result<NodeBuilder> {
     auto context = context_.lock();
-    if (context == nullptr || context->builder == nullptr || value_ == nullptr) {
+    if (context == nullptr || context->builder == nullptr || value_ == nullptr ||
+        context->generation != generation_) {
         return makeUnexpected<NodeBuilder>(Error{ErrorCode::InvalidState, "Builder node is not initialized."});
     }
 
@@ -221,7 +487,7 @@ auto NodeBuilder::pushArray() -> Result<NodeBuilder> {
     if (!pushResult) {
         return makeUnexpected<NodeBuilder>(pushResult.error());
     }
-    return NodeBuilder(context, array);
+    return NodeBuilder(context, generation_, array);
 }
 
 Builder::Builder(std::unique_ptr<Impl> impl) noexcept : impl_(std::move(impl)) {
@@ -253,6 +519,8 @@ auto Builder::create(BuilderOptions options) -> Result<Builder> {
     auto impl = std::make_unique<Builder::Impl>();
     impl->context = std::make_shared<NodeBuilder::Context>();
     impl->context->builder = std::move(rawBuilder);
+    impl->context->options = options;
+    impl->context->temporalTag = temporalTag();
 
     return Builder(std::move(impl));
 }
@@ -265,7 +533,26 @@ auto Builder::root() -> NodeBuilder {
     if (!isValid()) {
         return {};
     }
-    return NodeBuilder(impl_->context, fastoml_builder_root(impl_->context->builder.get()));
+    return NodeBuilder(
+        impl_->context, impl_->context->generation, fastoml_builder_root(impl_->context->builder.get()));
+}
+
+auto Builder::reset() -> Result<void> {
+    if (!isValid()) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Builder is not initialized."});
+    }
+
+    auto& context = *impl_->context;
+    ++context.generation;
+    context.builder.reset();
+    context.temporals.clear();
+
+    const auto fastOptions = detail::toFastomlBuilderOptions(context.options);
+    context.builder.reset(fastoml_builder_create(&fastOptions));
+    if (context.builder == nullptr) {
+        return makeUnexpected<void>(Error{ErrorCode::OutOfMemory, "Failed to recreate fastoml builder instance."});
+    }
+    return {};
 }
 
 auto Builder::toToml(SerializeOptions options) const -> Result<std::string> {
@@ -278,23 +565,44 @@ auto Builder::toToml(SerializeOptions options) const -> Result<std::string> {
         return makeUnexpected<std::string>(Error{ErrorCode::InvalidState, "Builder root node is null."});
     }
 
-    const auto fastOptions = detail::toFastomlSerializeOptions(options);
+    const auto& context = *impl_->context;
+    std::string output;
+    auto status = serializeValue(rootValue, options, context.temporalTag, context.temporals, output);
+    if (!status) {
+        return makeUnexpected<std::string>(status.error());
+    }
+    return output;
+}
 
-    std::size_t textLength = 0u;
-    auto status = fastoml_serialize_to_buffer(rootValue, &fastOptions, nullptr, 0u, &textLength);
-    if (status != FASTOML_OK) {
-        return makeUnexpected<std::string>(
-            detail::toError(status, nullptr, "Failed to estimate serialized TOML size"));
+auto Builder::toToml(std::pmr::string& output, SerializeOptions options) const -> Result<void> {
+    if (!isValid()) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Builder is not initialized."});
     }
 
-    std::vector<char> buffer(textLength + 1u, '\0');
-    status = fastoml_serialize_to_buffer(rootValue, &fastOptions, buffer.data(), buffer.size(), &textLength);
-    if (status != FASTOML_OK) {
-        return makeUnexpected<std::string>(
-            detail::toError(status, nullptr, "Failed to serialize TOML document"));
+    const auto* rootValue = fastoml_builder_root(impl_->context->builder.get());
+    if (rootValue == nullptr) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Builder root node is null."});
+    }
+
+    const auto& context = *impl_->context;
+    return serializeValue(rootValue, options, context.temporalTag, context.temporals, output);
+}
+
+auto Builder::finish(ParseOptions options) const -> Result<Document> {
+    if (!isValid()) {
+        return makeUnexpected<Document>(Error{ErrorCode::InvalidState, "Builder is not initialized."});
+    }
+
+    const auto* rootValue = fastoml_builder_root(impl_->context->builder.get());
+    if (rootValue == nullptr) {
+        return makeUnexpected<Document>(Error{ErrorCode::InvalidState, "Builder root node is null."});
     }
 
-    return std::string(buffer.data(), textLength);
+    // Serialize straight into the document's owned source so the text is produced and parsed in place.
+    const auto& context = *impl_->context;
+    return Document::parseOwned(options, [rootValue, &context](std::pmr::string& source) {
+        return serializeValue(rootValue, SerializeOptions{}, context.temporalTag, context.temporals, source);
+    });
 }
 
 } // namespace Fastoml
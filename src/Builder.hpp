@@ -1,11 +1,14 @@
 #pragma once
 
+#include "Document.hpp"
 #include "Error.hpp"
+#include "NodeView.hpp"
 #include "Options.hpp"
 
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -28,6 +31,7 @@ public:
     [[nodiscard]] auto set(std::string_view key, std::string_view value) -> Result<NodeBuilder>;
 
     [[nodiscard]] auto set(std::string_view key, const char* value) -> Result<NodeBuilder>;
+    [[nodiscard]] auto set(std::string_view key, const NodeView& value) -> Result<NodeBuilder>;
 
     template <typename T>
     [[nodiscard]] auto set(std::string_view key, T value) -> Result<NodeBuilder>
@@ -52,6 +56,7 @@ public:
     [[nodiscard]] auto push(double value) -> Result<NodeBuilder>;
     [[nodiscard]] auto push(std::string_view value) -> Result<NodeBuilder>;
     [[nodiscard]] auto push(const char* value) -> Result<NodeBuilder>;
+    [[nodiscard]] auto push(const NodeView& value) -> Result<NodeBuilder>;
     [[nodiscard]] auto pushTable() -> Result<NodeBuilder>;
     [[nodiscard]] auto pushArray() -> Result<NodeBuilder>;
 
@@ -73,12 +78,15 @@ public:
 private:
     struct Context;
     std::weak_ptr<Context> context_;
+    std::uint64_t generation_ = 0u;
     fastoml_value* value_ = nullptr;
 
-    NodeBuilder(std::weak_ptr<Context> context, fastoml_value* value) noexcept;
+    NodeBuilder(std::weak_ptr<Context> context, std::uint64_t generation, fastoml_value* value) noexcept;
 
     [[nodiscard]] auto setValue(std::string_view key, fastoml_value* value) -> Result<NodeBuilder>;
     [[nodiscard]] auto pushValue(fastoml_value* value) -> Result<NodeBuilder>;
+    [[nodiscard]] auto copyChildren(const NodeView& source) -> Result<void>;
+    [[nodiscard]] auto temporalPlaceholder(const NodeView& value) const -> Result<std::string>;
 
     friend class Builder;
 };
@@ -98,7 +106,10 @@ public:
 
     [[nodiscard]] auto isValid() const noexcept -> bool;
     [[nodiscard]] auto root() -> NodeBuilder;
+    [[nodiscard]] auto reset() -> Result<void>;
     [[nodiscard]] auto toToml(SerializeOptions options = {}) const -> Result<std::string>;
+    [[nodiscard]] auto toToml(std::pmr::string& output, SerializeOptions options = {}) const -> Result<void>;
+    [[nodiscard]] auto finish(ParseOptions options = {}) const -> Result<Document>;
 
 private:
     struct Impl;
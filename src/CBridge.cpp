@@ -1,7 +1,64 @@
 #include "detail/CInterop.hpp"
 
+#include <cstddef>
+#include <cstring>
 #include <limits>
-#include <string>
+#include <new>
+
+namespace {
+
+constexpr std::size_t allocationHeaderSize = alignof(std::max_align_t);
+
+static_assert(allocationHeaderSize >= sizeof(std::size_t), "Allocation header must be able to hold a size.");
+
+auto resourceMalloc(void* context, std::size_t size) -> void* {
+    auto* resource = static_cast<std::pmr::memory_resource*>(context);
+    try {
+        auto* block = static_cast<std::byte*>(resource->allocate(size + allocationHeaderSize, alignof(std::max_align_t)));
+        std::memcpy(block, &size, sizeof(size));
+        return block + allocationHeaderSize;
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+auto resourceFree(void* context, void* pointer) -> void {
+    if (pointer == nullptr) {
+        return;
+    }
+
+    auto* resource = static_cast<std::pmr::memory_resource*>(context);
+    auto* block = static_cast<std::byte*>(pointer) - allocationHeaderSize;
+    std::size_t size = 0u;
+    std::memcpy(&size, block, sizeof(size));
+    resource->deallocate(block, size + allocationHeaderSize, alignof(std::max_align_t));
+}
+
+auto resourceRealloc(void* context, void* pointer, std::size_t size) -> void* {
+    if (pointer == nullptr) {
+        return resourceMalloc(context, size);
+    }
+    if (size == 0u) {
+        resourceFree(context, pointer);
+        return nullptr;
+    }
+
+    std::size_t oldSize = 0u;
+    std::memcpy(&oldSize, static_cast<std::byte*>(pointer) - allocationHeaderSize, sizeof(oldSize));
+    if (size <= oldSize) {
+        return pointer;
+    }
+
+    auto* grown = resourceMalloc(context, size);
+    if (grown == nullptr) {
+        return nullptr;
+    }
+    std::memcpy(grown, pointer, oldSize);
+    resourceFree(context, pointer);
+    return grown;
+}
+
+} // namespace
 
 namespace Fastoml::detail {
 
@@ -28,14 +85,11 @@ auto toErrorCode(fastoml_status status) -> ErrorCode {
     }
 }
 
-auto toError(fastoml_status status, const fastoml_error* error, std::string_view context) -> Error {
+auto toError(fastoml_status status, const fastoml_error* error, const char* context) -> Error {
     Error out;
     out.code = toErrorCode(status);
-    out.message = std::string(context);
-    if (status != FASTOML_OK) {
-        out.message += ": ";
-        out.message += fastoml_status_string(status);
-    }
+    out.summary = context;
+    out.status = static_cast<int>(status);
 
     if (error != nullptr) {
         out.byteOffset = error->byte_offset;
@@ -46,6 +100,15 @@ auto toError(fastoml_status status, const fastoml_error* error, std::string_view
     return out;
 }
 
+auto toFastomlAllocator(std::pmr::memory_resource* resource) -> fastoml_allocator {
+    fastoml_allocator out{};
+    out.malloc_fn = &resourceMalloc;
+    out.realloc_fn = &resourceRealloc;
+    out.free_fn = &resourceFree;
+    out.ctx = resource;
+    return out;
+}
+
 auto toFastomlOptions(const ParseOptions& options) -> fastoml_options {
     fastoml_options out;
     fastoml_options_default(&out);
@@ -61,6 +124,9 @@ auto toFastomlOptions(const ParseOptions& options) -> fastoml_options {
         out.flags |= FASTOML_PARSE_TRUST_UTF8;
     }
     out.max_depth = options.maxDepth;
+    if (options.memoryResource != nullptr) {
+        out.alloc = toFastomlAllocator(options.memoryResource);
+    }
     return out;
 }
 
@@ -68,6 +134,9 @@ auto toFastomlBuilderOptions(const BuilderOptions& options) -> fastoml_builder_o
     fastoml_builder_options out;
     fastoml_builder_options_default(&out);
     out.max_depth = options.maxDepth;
+    if (options.memoryResource != nullptr) {
+        out.alloc = toFastomlAllocator(options.memoryResource);
+    }
     return out;
 }
 
@@ -92,4 +161,44 @@ auto toSlice(std::string_view value) -> Result<fastoml_slice> {
     return slice;
 }
 
+auto checkSourceSize(std::string_view source) -> Result<void> {
+    if (source.size() > static_cast<std::size_t>((std::numeric_limits<std::uint32_t>::max)())) {
+        return makeUnexpected<void>(
+            Error{ErrorCode::Overflow, "Input exceeds fastoml's 32-bit offset limit; use parseLarge()."});
+    }
+    return {};
+}
+
+auto nodeSource(const fastoml_node* node) noexcept -> std::string_view {
+    fastoml_slice slice{};
+    if (node == nullptr || fastoml_node_source(node, &slice) != FASTOML_OK || slice.ptr == nullptr) {
+        return {};
+    }
+    return std::string_view(slice.ptr, slice.len);
+}
+
+auto inlineNodeSource(const fastoml_node* node) noexcept -> std::string_view {
+    if (node == nullptr) {
+        return {};
+    }
+    const auto kind = fastoml_node_kindof(node);
+    if (kind != FASTOML_NODE_TABLE && kind != FASTOML_NODE_ARRAY) {
+        return {};
+    }
+    if (kind == FASTOML_NODE_ARRAY && fastoml_array_size(node) != 0u) {
+        const auto* first = fastoml_array_at(node, 0u);
+        if (first == nullptr || (fastoml_node_kindof(first) == FASTOML_NODE_TABLE && inlineNodeSource(first).empty())) {
+            return {};
+        }
+    }
+
+    const auto source = nodeSource(node);
+    const auto open = kind == FASTOML_NODE_TABLE ? '{' : '[';
+    const auto close = kind == FASTOML_NODE_TABLE ? '}' : ']';
+    if (source.size() < 2u || source.front() != open || source.back() != close) {
+        return {};
+    }
+    return source;
+}
+
 } // namespace Fastoml::detail
@@ -0,0 +1,140 @@
+#include "CompiledPath.hpp"
+
+#include "detail/PathParser.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace Fastoml {
+
+namespace {
+
+auto lessBySegments(const CompiledPath& lhs, const CompiledPath& rhs) noexcept -> bool {
+    const auto count = std::min(lhs.segmentCount(), rhs.segmentCount());
+    for (std::size_t i = 0u; i < count; ++i) {
+        const auto order = lhs.segment(i).compare(rhs.segment(i));
+        if (order != 0) {
+            return order < 0;
+        }
+    }
+    return lhs.segmentCount() < rhs.segmentCount();
+}
+
+auto commonPrefix(const CompiledPath& lhs, const CompiledPath& rhs) noexcept -> std::size_t {
+    const auto count = std::min(lhs.segmentCount(), rhs.segmentCount());
+    std::size_t i = 0u;
+    while (i < count && lhs.segment(i) == rhs.segment(i)) {
+        ++i;
+    }
+    return i;
+}
+
+} // namespace
+
+auto CompiledPath::compile(std::string_view dotPath) -> Result<CompiledPath> {
+    if (dotPath.size() > static_cast<std::size_t>((std::numeric_limits<std::uint32_t>::max)())) {
+        return makeUnexpected<CompiledPath>(Error{ErrorCode::Overflow, "Dot path exceeds fastoml_slice length limit."});
+    }
+
+    auto segments = detail::splitDotPath(dotPath);
+    if (!segments) {
+        return makeUnexpected<CompiledPath>(segments.error());
+    }
+
+    CompiledPath out;
+    out.text_.assign(dotPath);
+    out.ends_.reserve(segments->size());
+    for (const auto segment : *segments) {
+        out.ends_.push_back(static_cast<std::uint32_t>(segment.data() + segment.size() - dotPath.data()));
+    }
+    return out;
+}
+
+auto CompiledPath::view() const noexcept -> std::string_view {
+    return text_;
+}
+
+auto CompiledPath::segmentCount() const noexcept -> std::size_t {
+    return ends_.size();
+}
+
+auto CompiledPath::segment(std::size_t index) const noexcept -> std::string_view {
+    const std::size_t begin = index == 0u ? 0u : ends_[index - 1u] + 1u;
+    return std::string_view(text_).substr(begin, ends_[index] - begin);
+}
+
+auto CompiledPathSet::compile(std::span<const CompiledPath> paths) -> Result<CompiledPathSet> {
+    constexpr auto limit = static_cast<std::size_t>((std::numeric_limits<std::uint32_t>::max)());
+    if (paths.size() >= limit) {
+        return makeUnexpected<CompiledPathSet>(Error{ErrorCode::Overflow, "Path set exceeds 2^32 paths."});
+    }
+
+    // Sorting by segments makes paths with a shared prefix adjacent at every level, so each distinct
+    // (parent, key) pair becomes one step and its targets form one contiguous run.
+    std::vector<std::uint32_t> order(paths.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::ranges::sort(order,
+                      [&](std::uint32_t lhs, std::uint32_t rhs) { return lessBySegments(paths[lhs], paths[rhs]); });
+
+    CompiledPathSet out;
+    out.targets_.reserve(paths.size());
+    out.steps_.push_back(Step{});
+
+    // open[d] is the index of the step at depth d on the current prefix; steps deeper than a new one are closed.
+    std::vector<std::uint32_t> open{0u};
+    const CompiledPath* previous = nullptr;
+    for (const auto index : order) {
+        const auto& path = paths[index];
+        const auto shared = previous != nullptr ? commonPrefix(*previous, path) : 0u;
+        for (std::size_t level = shared; level < path.segmentCount(); ++level) {
+            const auto segment = path.segment(level);
+            if (out.keys_.size() + segment.size() >= limit || out.steps_.size() >= limit) {
+                return makeUnexpected<CompiledPathSet>(Error{ErrorCode::Overflow, "Path set exceeds 2^32 steps."});
+            }
+
+            const auto step = static_cast<std::uint32_t>(out.steps_.size());
+            while (open.size() > level + 1u) {
+                out.steps_[open.back()].end = step;
+                open.pop_back();
+            }
+            Step next;
+            next.keyBegin = static_cast<std::uint32_t>(out.keys_.size());
+            next.keySize = static_cast<std::uint32_t>(segment.size());
+            next.depth = static_cast<std::uint32_t>(level + 1u);
+            next.firstTarget = static_cast<std::uint32_t>(out.targets_.size());
+            out.steps_.push_back(next);
+            out.keys_.append(segment);
+            open.push_back(step);
+        }
+
+        // Sorting puts a prefix before its extensions, so the path's last step is always the newest open one.
+        auto& target = out.steps_[open.back()];
+        if (target.targetCount == 0u) {
+            target.firstTarget = static_cast<std::uint32_t>(out.targets_.size());
+        }
+        ++target.targetCount;
+        out.targets_.push_back(index);
+        out.maxDepth_ = std::max(out.maxDepth_, path.segmentCount());
+        previous = &path;
+    }
+
+    for (const auto step : open) {
+        out.steps_[step].end = static_cast<std::uint32_t>(out.steps_.size());
+    }
+    return out;
+}
+
+auto CompiledPathSet::size() const noexcept -> std::size_t {
+    return targets_.size();
+}
+
+auto CompiledPathSet::stepCount() const noexcept -> std::size_t {
+    return steps_.empty() ? 0u : steps_.size() - 1u;
+}
+
+auto CompiledPathSet::key(const Step& step) const noexcept -> std::string_view {
+    return std::string_view(keys_).substr(step.keyBegin, step.keySize);
+}
+
+} // namespace Fastoml
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Error.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Fastoml {
+
+class CompiledPath {
+public:
+    CompiledPath() = default;
+
+    [[nodiscard]] static auto compile(std::string_view dotPath) -> Result<CompiledPath>;
+
+    [[nodiscard]] auto view() const noexcept -> std::string_view;
+    [[nodiscard]] auto segmentCount() const noexcept -> std::size_t;
+    [[nodiscard]] auto segment(std::size_t index) const noexcept -> std::string_view;
+
+private:
+    std::string text_;
+    std::vector<std::uint32_t> ends_;
+};
+
+// A batch of paths merged into one prefix walk at compile time, so Document::getMany neither sorts nor allocates
+// per call. Each step probes one key under the step that owns its parent prefix; steps are stored depth-first.
+class CompiledPathSet {
+public:
+    CompiledPathSet() = default;
+
+    [[nodiscard]] static auto compile(std::span<const CompiledPath> paths) -> Result<CompiledPathSet>;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+    [[nodiscard]] auto stepCount() const noexcept -> std::size_t;
+
+private:
+    struct Step {
+        std::uint32_t keyBegin = 0u;
+        std::uint32_t keySize = 0u;
+        std::uint32_t depth = 0u;
+        std::uint32_t end = 0u;
+        std::uint32_t firstTarget = 0u;
+        std::uint32_t targetCount = 0u;
+    };
+
+    std::string keys_;
+    std::vector<Step> steps_;
+    std::vector<std::uint32_t> targets_;
+    std::size_t maxDepth_ = 0u;
+
+    [[nodiscard]] auto key(const Step& step) const noexcept -> std::string_view;
+
+    friend class Document;
+};
+
+} // namespace Fastoml
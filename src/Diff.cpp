@@ -0,0 +1,408 @@
+#include "Diff.hpp"
+
+#include "detail/CInterop.hpp"
+#include "detail/TomlFormat.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <span>
+#include <utility>
+
+namespace Fastoml {
+
+namespace {
+
+// Identical inline text means identical values, so the subtree walk can be skipped.
+auto sameInlineSource(const NodeView& left, const NodeView& right) -> bool {
+    const auto leftSource = detail::inlineNodeSource(left.raw());
+    return !leftSource.empty() && leftSource == detail::inlineNodeSource(right.raw());
+}
+
+auto equalScalars(const NodeView& left, const NodeView& right) -> bool {
+    switch (left.kind()) {
+    case NodeKind::Int:
+        return left.tryAs<std::int64_t>() == right.tryAs<std::int64_t>();
+    case NodeKind::Float: {
+        const auto leftValue = left.tryAs<double>();
+        const auto rightValue = right.tryAs<double>();
+        if (leftValue && rightValue && std::isnan(*leftValue) && std::isnan(*rightValue)) {
+            return true;
+        }
+        return leftValue == rightValue;
+    }
+    case NodeKind::Bool:
+        return left.tryAs<bool>() == right.tryAs<bool>();
+    default:
+        return left.tryAs<std::string_view>() == right.tryAs<std::string_view>();
+    }
+}
+
+auto appendValue(std::string& output, const NodeView& node) -> Result<void> {
+    switch (node.kind()) {
+    case NodeKind::Table: {
+        const auto count = node.size();
+        output += count == 0u ? "{" : "{ ";
+        for (std::size_t i = 0u; i < count; ++i) {
+            auto key = node.keyAt(i);
+            if (!key) {
+                return makeUnexpected<void>(key.error());
+            }
+            auto value = node.at(i);
+            if (!value) {
+                return makeUnexpected<void>(value.error());
+            }
+
+            if (i != 0u) {
+                output += ", ";
+            }
+            detail::appendTomlKey(output, *key);
+            output += " = ";
+            auto status = appendValue(output, *value);
+            if (!status) {
+                return status;
+            }
+        }
+        output += count == 0u ? "}" : " }";
+        return {};
+    }
+    case NodeKind::Array: {
+        output += '[';
+        const auto count = node.size();
+        for (std::size_t i = 0u; i < count; ++i) {
+            auto value = node.at(i);
+            if (!value) {
+                return makeUnexpected<void>(value.error());
+            }
+
+            if (i != 0u) {
+                output += ", ";
+            }
+            auto status = appendValue(output, *value);
+            if (!status) {
+                return status;
+            }
+        }
+        output += ']';
+        return {};
+    }
+    case NodeKind::Int: {
+        auto value = node.asInt64();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        detail::appendTomlInt(output, *value);
+        return {};
+    }
+    case NodeKind::Float: {
+        auto value = node.asDouble();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        detail::appendTomlFloat(output, *value);
+        return {};
+    }
+    case NodeKind::Bool: {
+        auto value = node.asBool();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        output += *value ? "true" : "false";
+        return {};
+    }
+    case NodeKind::String: {
+        auto value = node.asStringView();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        detail::appendTomlString(output, *value);
+        return {};
+    }
+    case NodeKind::DateTime:
+    case NodeKind::Date:
+    case NodeKind::Time: {
+        auto value = node.asStringView();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        output += *value;
+        return {};
+    }
+    default:
+        return makeUnexpected<void>(Error{ErrorCode::UnsupportedType, "Node kind cannot be stored in a patch."});
+    }
+}
+
+auto pushEntry(Patch& patch, PatchOp op, const std::vector<std::string_view>& path, const NodeView& value)
+    -> Result<void> {
+    PatchEntry entry;
+    entry.op = op;
+    entry.path.assign(path.begin(), path.end());
+    if (value.valid()) {
+        auto status = appendValue(entry.value, value);
+        if (!status) {
+            return status;
+        }
+    }
+    patch.push_back(std::move(entry));
+    return {};
+}
+
+struct PendingEntry {
+    const PatchEntry* entry = nullptr;
+    NodeView value;
+};
+
+auto diffTables(const NodeView& before, const NodeView& after, std::vector<std::string_view>& path, Patch& patch)
+    -> Result<void> {
+    const auto beforeCount = before.size();
+    for (std::size_t i = 0u; i < beforeCount; ++i) {
+        const auto key = before.keyAt(i);
+        const auto beforeValue = before.at(i);
+        if (!key || !beforeValue) {
+            continue;
+        }
+
+        path.push_back(*key);
+        const auto afterValue = after.find(*key);
+        Result<void> status;
+        if (!afterValue.valid()) {
+            status = pushEntry(patch, PatchOp::Remove, path, {});
+        } else if (beforeValue->kind() == NodeKind::Table && afterValue.kind() == NodeKind::Table) {
+            if (!sameInlineSource(*beforeValue, afterValue)) {
+                status = diffTables(*beforeValue, afterValue, path, patch);
+            }
+        } else if (!equivalent(*beforeValue, afterValue)) {
+            status = pushEntry(patch, PatchOp::Change, path, afterValue);
+        }
+        path.pop_back();
+        if (!status) {
+            return status;
+        }
+    }
+
+    const auto afterCount = after.size();
+    for (std::size_t i = 0u; i < afterCount; ++i) {
+        const auto key = after.keyAt(i);
+        const auto afterValue = after.at(i);
+        if (!key || !afterValue || before.find(*key).valid()) {
+            continue;
+        }
+
+        path.push_back(*key);
+        auto status = pushEntry(patch, PatchOp::Add, path, *afterValue);
+        path.pop_back();
+        if (!status) {
+            return status;
+        }
+    }
+    return {};
+}
+
+auto segmentAt(const PendingEntry& pending, std::size_t depth) -> std::string_view {
+    return pending.entry->path[depth];
+}
+
+auto applyTable(const NodeView& base, NodeBuilder& output, std::span<PendingEntry> entries, std::size_t depth)
+    -> Result<void> {
+    // Group entries by their segment at this depth. Within a group, deeper entries come first and patch order is
+    // kept, so each base key finds its entries with one binary search and the last direct entry still wins.
+    std::ranges::sort(entries, [depth](const PendingEntry& left, const PendingEntry& right) {
+        const auto leftSegment = segmentAt(left, depth);
+        const auto rightSegment = segmentAt(right, depth);
+        if (leftSegment != rightSegment) {
+            return leftSegment < rightSegment;
+        }
+        const auto leftDirect = left.entry->path.size() == depth + 1u;
+        const auto rightDirect = right.entry->path.size() == depth + 1u;
+        if (leftDirect != rightDirect) {
+            return rightDirect;
+        }
+        return std::less<>{}(left.entry, right.entry);
+    });
+    const auto segment = [depth](const PendingEntry& pending) { return segmentAt(pending, depth); };
+
+    const auto count = base.size();
+    for (std::size_t i = 0u; i < count; ++i) {
+        const auto key = base.keyAt(i);
+        const auto value = base.at(i);
+        if (!key) {
+            return makeUnexpected<void>(key.error());
+        }
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+
+        const auto group = std::ranges::equal_range(entries, *key, std::ranges::less{}, segment);
+        const auto directBegin = std::ranges::partition_point(
+            group, [depth](const PendingEntry& pending) { return pending.entry->path.size() != depth + 1u; });
+        const auto nested = std::span<PendingEntry>(group.begin(), directBegin);
+        const PendingEntry* direct = directBegin != group.end() ? &*(group.end() - 1) : nullptr;
+
+        if (direct != nullptr) {
+            if (direct->entry->op == PatchOp::Remove) {
+                continue;
+            }
+            auto status = output.set(*key, direct->value);
+            if (!status) {
+                return makeUnexpected<void>(status.error());
+            }
+        } else if (!nested.empty() && value->kind() == NodeKind::Table) {
+            auto child = output.table(*key);
+            if (!child) {
+                return makeUnexpected<void>(child.error());
+            }
+            auto status = applyTable(*value, *child, nested, depth + 1u);
+            if (!status) {
+                return status;
+            }
+        } else {
+            auto status = output.set(*key, *value);
+            if (!status) {
+                return makeUnexpected<void>(status.error());
+            }
+        }
+    }
+
+    for (const auto& pending : entries) {
+        const auto& entry = *pending.entry;
+        if (entry.op != PatchOp::Add || entry.path.size() != depth + 1u || base.find(entry.path[depth]).valid()) {
+            continue;
+        }
+        auto status = output.set(entry.path[depth], pending.value);
+        if (!status) {
+            return makeUnexpected<void>(status.error());
+        }
+    }
+    return {};
+}
+
+} // namespace
+
+auto PatchEntry::dotPath() const -> std::string {
+    std::string out;
+    for (const auto& segment : path) {
+        if (!out.empty()) {
+            out += '.';
+        }
+        out += segment;
+    }
+    return out;
+}
+
+auto equivalent(const NodeView& left, const NodeView& right) -> bool {
+    if (left.kind() != right.kind()) {
+        return false;
+    }
+    if (sameInlineSource(left, right)) {
+        return true;
+    }
+    switch (left.kind()) {
+    case NodeKind::Table: {
+        const auto count = left.size();
+        if (count != right.size()) {
+            return false;
+        }
+        for (std::size_t i = 0u; i < count; ++i) {
+            const auto key = left.keyAt(i);
+            const auto value = left.at(i);
+            if (!key || !value || !equivalent(*value, right.find(*key))) {
+                return false;
+            }
+        }
+        return true;
+    }
+    case NodeKind::Array: {
+        const auto count = left.size();
+        if (count != right.size()) {
+            return false;
+        }
+        for (std::size_t i = 0u; i < count; ++i) {
+            const auto leftValue = left.at(i);
+            const auto rightValue = right.at(i);
+            if (!leftValue || !rightValue || !equivalent(*leftValue, *rightValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    default:
+        return equalScalars(left, right);
+    }
+}
+
+auto diff(const Document& before, const Document& after) -> Result<Patch> {
+    auto beforeRoot = before.root();
+    if (!beforeRoot) {
+        return makeUnexpected<Patch>(beforeRoot.error());
+    }
+    auto afterRoot = after.root();
+    if (!afterRoot) {
+        return makeUnexpected<Patch>(afterRoot.error());
+    }
+
+    Patch patch;
+    std::vector<std::string_view> path;
+    auto status = diffTables(*beforeRoot, *afterRoot, path, patch);
+    if (!status) {
+        return makeUnexpected<Patch>(status.error());
+    }
+    return patch;
+}
+
+auto apply(const Patch& patch, const Document& base, Builder& output) -> Result<void> {
+    auto baseRoot = base.root();
+    if (!baseRoot) {
+        return makeUnexpected<void>(baseRoot.error());
+    }
+
+    auto outputRoot = output.root();
+    if (!outputRoot.valid()) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Builder is not initialized."});
+    }
+
+    // Parse every carried value in one pass: entry i becomes key "v<i>" of a scratch document.
+    std::string valuesToml;
+    for (std::size_t i = 0u; i < patch.size(); ++i) {
+        const auto& entry = patch[i];
+        if (entry.path.empty()) {
+            return makeUnexpected<void>(Error{ErrorCode::InvalidPath, "Patch entry has an empty path."});
+        }
+        if (entry.op == PatchOp::Remove) {
+            continue;
+        }
+        if (entry.value.empty()) {
+            auto error = Error{ErrorCode::InvalidState, "Patch entry has no value."};
+            error.index = i;
+            return makeUnexpected<void>(error);
+        }
+
+        valuesToml += 'v';
+        detail::appendTomlInt(valuesToml, static_cast<std::int64_t>(i));
+        valuesToml += " = ";
+        valuesToml += entry.value;
+        valuesToml += '\n';
+    }
+
+    auto values = parse(valuesToml);
+    if (!values) {
+        return makeUnexpected<void>(values.error());
+    }
+
+    std::vector<PendingEntry> entries;
+    entries.reserve(patch.size());
+    std::string valueKey;
+    for (std::size_t i = 0u; i < patch.size(); ++i) {
+        PendingEntry pending;
+        pending.entry = &patch[i];
+        if (patch[i].op != PatchOp::Remove) {
+            valueKey = "v";
+            detail::appendTomlInt(valueKey, static_cast<std::int64_t>(i));
+            pending.value = values->find(valueKey);
+        }
+        entries.push_back(pending);
+    }
+    return applyTable(*baseRoot, outputRoot, entries, 0u);
+}
+
+} // namespace Fastoml
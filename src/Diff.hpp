@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Builder.hpp"
+#include "Document.hpp"
+#include "NodeView.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Fastoml {
+
+enum class PatchOp {
+    Add,
+    Remove,
+    Change,
+};
+
+struct PatchEntry {
+    PatchOp op = PatchOp::Change;
+    std::vector<std::string> path;
+    std::string value;
+
+    [[nodiscard]] auto dotPath() const -> std::string;
+};
+
+using Patch = std::vector<PatchEntry>;
+
+[[nodiscard]] auto equivalent(const NodeView& left, const NodeView& right) -> bool;
+[[nodiscard]] auto diff(const Document& before, const Document& after) -> Result<Patch>;
+[[nodiscard]] auto apply(const Patch& patch, const Document& base, Builder& output) -> Result<void>;
+
+} // namespace Fastoml
@@ -2,11 +2,14 @@
 
 #include "detail/CInterop.hpp"
 #include "detail/PathParser.hpp"
+#include "detail/SourceMap.hpp"
 
 #include <fastoml.h>
 
+#include <algorithm>
+#include <array>
 #include <memory>
-#include <string>
+#include <memory_resource>
 #include <utility>
 
 namespace Fastoml {
@@ -15,17 +18,113 @@ namespace {
 
 using ParserPtr = std::unique_ptr<fastoml_parser, decltype(&fastoml_parser_destroy)>;
 
+auto sourceResource(const ParseOptions& options) -> std::pmr::memory_resource* {
+    return options.memoryResource != nullptr ? options.memoryResource : std::pmr::get_default_resource();
+}
+
+class CountingResource final : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream) noexcept : upstream_(upstream) {
+    }
+
+    [[nodiscard]] auto bytes() const noexcept -> std::size_t {
+        return bytes_;
+    }
+
+private:
+    std::pmr::memory_resource* upstream_;
+    std::size_t bytes_ = 0u;
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+        auto* pointer = upstream_->allocate(bytes, alignment);
+        bytes_ += bytes;
+        return pointer;
+    }
+
+    auto do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) -> void override {
+        upstream_->deallocate(pointer, bytes, alignment);
+        bytes_ -= bytes;
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+        return this == &other;
+    }
+};
+
+auto collectStats(const fastoml_node* node, std::uint32_t depth, DocumentStats& stats) -> void {
+    ++stats.nodeCount;
+    if (depth > stats.maxDepth) {
+        stats.maxDepth = depth;
+    }
+
+    const auto nodeKind = fastoml_node_kindof(node);
+    if (nodeKind == FASTOML_NODE_TABLE) {
+        const auto count = fastoml_table_size(node);
+        for (std::uint32_t i = 0u; i < count; ++i) {
+            collectStats(fastoml_table_value_at(node, i), depth + 1u, stats);
+        }
+    } else if (nodeKind == FASTOML_NODE_ARRAY) {
+        const auto count = fastoml_array_size(node);
+        for (std::uint32_t i = 0u; i < count; ++i) {
+            collectStats(fastoml_array_at(node, i), depth + 1u, stats);
+        }
+    }
+}
+
+auto locateError(const detail::SourceMap& sourceMap, const fastoml_node* node, Error error) -> Error {
+    const auto location = sourceMap.locate(detail::nodeSource(node));
+    if (location) {
+        error.byteOffset = location->byteOffset;
+        error.line = location->line;
+        error.column = location->column;
+    }
+    return error;
+}
+
+auto probeTable(const fastoml_node* table, std::string_view key) noexcept -> const fastoml_node* {
+    if (table == nullptr || fastoml_node_kindof(table) != FASTOML_NODE_TABLE) {
+        return nullptr;
+    }
+
+    fastoml_slice slice;
+    slice.ptr = key.data();
+    slice.len = static_cast<std::uint32_t>(key.size());
+    return fastoml_table_get(table, slice);
+}
+
+auto prefetchNode(const fastoml_node* node) noexcept -> void {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(node, 0, 3);
+#else
+    (void)node;
+#endif
+}
+
 } // namespace
 
 struct Document::Impl {
-    std::string source;
+    explicit Impl(std::pmr::memory_resource* resource)
+#if FASTOML_CPP_INSTRUMENTATION
+        : counter(resource), source(&counter) {
+    }
+
+    CountingResource counter;
+#else
+        : source(resource) {
+    }
+#endif
+
+    std::pmr::string source;
     ParserPtr parser{nullptr, &fastoml_parser_destroy};
     const fastoml_document* document = nullptr;
+    detail::SourceMap sourceMap;
 };
 
 Document::Document(std::unique_ptr<Impl> impl) noexcept : impl_(std::move(impl)) {
 }
 
+Document::Document() noexcept = default;
+
 Document::~Document() = default;
 
 Document::Document(Document&& other) noexcept = default;
@@ -45,10 +144,12 @@ auto Document::root() const -> Result<NodeView> {
     if (rootNode == nullptr) {
         return makeUnexpected<NodeView>(Error{ErrorCode::InvalidState, "Parsed document returned a null root node."});
     }
-    return NodeView(rootNode);
+    return NodeView(rootNode, &impl_->sourceMap);
 }
 
 auto Document::get(std::string_view dotPath) const -> Result<NodeView> {
+    FASTOML_CPP_INSTRUMENT(Operation::Get, dotPath.size());
+
     auto rootNode = root();
     if (!rootNode) {
         return makeUnexpected<NodeView>(rootNode.error());
@@ -58,16 +159,17 @@ auto Document::get(std::string_view dotPath) const -> Result<NodeView> {
         return *rootNode;
     }
 
-    auto parts = detail::splitDotPath(dotPath);
-    if (!parts) {
-        return makeUnexpected<NodeView>(parts.error());
-    }
-
     const fastoml_node* current = rootNode->raw();
-    for (const auto segment : *parts) {
+    detail::DotPathCursor cursor(dotPath);
+    while (!cursor.done()) {
+        const auto segment = cursor.next();
+        if (segment.empty()) {
+            return makeUnexpected<NodeView>(Error{ErrorCode::InvalidPath, "Dot path contains an empty segment."});
+        }
         if (fastoml_node_kindof(current) != FASTOML_NODE_TABLE) {
-            return makeUnexpected<NodeView>(
-                Error{ErrorCode::Type, "Path traversal requires table nodes for each segment."});
+            return makeUnexpected<NodeView>(locateError(
+                impl_->sourceMap, current,
+                keyError(ErrorCode::Type, "Path traversal requires table nodes for each segment.", dotPath, segment)));
         }
 
         auto key = detail::toSlice(segment);
@@ -75,18 +177,201 @@ auto Document::get(std::string_view dotPath) const -> Result<NodeView> {
             return makeUnexpected<NodeView>(key.error());
         }
 
+        const auto* child = fastoml_table_get(current, *key);
+        if (child == nullptr) {
+            return makeUnexpected<NodeView>(
+                locateError(impl_->sourceMap, current,
+                            keyError(ErrorCode::KeyNotFound, "Key not found in table", dotPath, segment)));
+        }
+        current = child;
+    }
+
+    return NodeView(current, &impl_->sourceMap);
+}
+
+auto Document::source() const noexcept -> std::string_view {
+    return impl_ != nullptr ? std::string_view(impl_->source) : std::string_view{};
+}
+
+auto Document::reparse(std::string_view toml) -> Result<void> {
+    FASTOML_CPP_INSTRUMENT(Operation::Parse, toml.size());
+
+    if (impl_ == nullptr || impl_->parser == nullptr) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Only a parsed document can be reparsed."});
+    }
+    auto size = detail::checkSourceSize(toml);
+    if (!size) {
+        return size;
+    }
+
+    impl_->document = nullptr;
+    impl_->source.assign(toml);
+
+    const fastoml_document* parsedDocument = nullptr;
+    fastoml_error parseError{};
+    const auto status = fastoml_parse(
+        impl_->parser.get(), impl_->source.data(), impl_->source.size(), &parsedDocument, &parseError);
+    if (status != FASTOML_OK) {
+        return makeUnexpected<void>(detail::toError(status, &parseError, "Parse failed"));
+    }
+    if (parsedDocument == nullptr) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "fastoml returned a null parsed document."});
+    }
+
+    impl_->document = parsedDocument;
+    impl_->sourceMap.setSource(impl_->source);
+    return {};
+}
+
+auto Document::find(std::string_view dotPath) const noexcept -> NodeView {
+    if (!isValid()) {
+        return {};
+    }
+
+    const fastoml_node* current = fastoml_doc_root(impl_->document);
+    if (current == nullptr) {
+        return {};
+    }
+    if (dotPath.empty()) {
+        return NodeView(current, &impl_->sourceMap);
+    }
+
+    detail::DotPathCursor cursor(dotPath);
+    while (!cursor.done()) {
+        const auto segment = cursor.next();
+        if (segment.empty() || fastoml_node_kindof(current) != FASTOML_NODE_TABLE) {
+            return {};
+        }
+
+        auto key = detail::toSlice(segment);
+        if (!key) {
+            return {};
+        }
+
         current = fastoml_table_get(current, *key);
         if (current == nullptr) {
-            auto message = std::string("Key not found in table: ");
-            message += segment;
-            return makeUnexpected<NodeView>(Error{ErrorCode::KeyNotFound, std::move(message)});
+            return {};
         }
     }
+    return NodeView(current, &impl_->sourceMap);
+}
+
+auto Document::find(const CompiledPath& path) const noexcept -> NodeView {
+    if (!isValid()) {
+        return {};
+    }
 
-    return NodeView(current);
+    const fastoml_node* current = fastoml_doc_root(impl_->document);
+    for (std::size_t i = 0u; i < path.segmentCount() && current != nullptr; ++i) {
+        current = probeTable(current, path.segment(i));
+    }
+    return current != nullptr ? NodeView(current, &impl_->sourceMap) : NodeView();
 }
 
-auto parse(std::string_view toml, ParseOptions options) -> Result<Document> {
+auto Document::getMany(const CompiledPathSet& paths, std::span<NodeView> output) const -> Result<std::size_t> {
+    FASTOML_CPP_INSTRUMENT(Operation::Get, paths.size());
+
+    if (!isValid()) {
+        return makeUnexpected<std::size_t>(Error{ErrorCode::InvalidState, "Document has no parsed root node."});
+    }
+    if (output.size() < paths.size()) {
+        return makeUnexpected<std::size_t>(
+            Error{ErrorCode::Overflow, "Output span is smaller than the number of paths."});
+    }
+    std::ranges::fill(output.first(paths.size()), NodeView());
+    if (paths.steps_.empty()) {
+        return 0u;
+    }
+
+    // Steps are depth-first, so the parent of a step at depth d is the latest node resolved at depth d - 1.
+    constexpr std::size_t inlineDepth = 16u;
+    std::array<const fastoml_node*, inlineDepth> inlineStack{};
+    std::vector<const fastoml_node*> heapStack;
+    std::span<const fastoml_node*> stack(inlineStack);
+    if (paths.maxDepth_ >= inlineDepth) {
+        heapStack.resize(paths.maxDepth_ + 1u);
+        stack = heapStack;
+    }
+
+    std::size_t found = 0u;
+    const auto resolve = [&](const CompiledPathSet::Step& step, const fastoml_node* node) {
+        for (std::uint32_t i = 0u; i < step.targetCount; ++i) {
+            output[paths.targets_[step.firstTarget + i]] = NodeView(node, &impl_->sourceMap);
+        }
+        found += step.targetCount;
+    };
+
+    stack[0] = fastoml_doc_root(impl_->document);
+    resolve(paths.steps_.front(), stack[0]);
+
+    std::size_t index = 1u;
+    while (index < paths.steps_.size()) {
+        const auto& step = paths.steps_[index];
+        const auto* child = probeTable(stack[step.depth - 1u], paths.key(step));
+        if (child == nullptr) {
+            // Nothing under a missing key can resolve; skip the whole subtree.
+            index = step.end;
+            continue;
+        }
+
+        // Warm the child for the probes of its own subtree, which follow immediately in depth-first order.
+        prefetchNode(child);
+        stack[step.depth] = child;
+        resolve(step, child);
+        ++index;
+    }
+    return found;
+}
+
+auto Document::getMany(std::span<const CompiledPath> paths, std::span<NodeView> output) const -> Result<std::size_t> {
+    auto set = CompiledPathSet::compile(paths);
+    if (!set) {
+        return makeUnexpected<std::size_t>(set.error());
+    }
+    return getMany(*set, output);
+}
+
+auto Document::getMany(std::span<const CompiledPath> paths) const -> Result<std::vector<NodeView>> {
+    std::vector<NodeView> output(paths.size());
+    auto status = getMany(paths, output);
+    if (!status) {
+        return makeUnexpected<std::vector<NodeView>>(status.error());
+    }
+    return output;
+}
+
+auto Document::stats() const -> Result<DocumentStats> {
+    auto rootNode = root();
+    if (!rootNode) {
+        return makeUnexpected<DocumentStats>(rootNode.error());
+    }
+
+    DocumentStats out;
+    out.sourceBytes = impl_->source.size();
+#if FASTOML_CPP_INSTRUMENTATION
+    out.arenaBytes = impl_->counter.bytes();
+#endif
+    collectStats(rootNode->raw(), 0u, out);
+    return out;
+}
+
+auto Document::parseOwned(ParseOptions options, const SourceWriter& writeSource) -> Result<Document> {
+    auto impl = std::make_unique<Document::Impl>(sourceResource(options));
+#if FASTOML_CPP_INSTRUMENTATION
+    options.memoryResource = &impl->counter;
+#endif
+
+    auto written = writeSource(impl->source);
+    if (!written) {
+        return makeUnexpected<Document>(written.error());
+    }
+    // Recorded after the source is written so a Builder::finish serialize is not counted as parse time.
+    FASTOML_CPP_INSTRUMENT(Operation::Parse, impl->source.size());
+    auto size = detail::checkSourceSize(impl->source);
+    if (!size) {
+        return makeUnexpected<Document>(size.error());
+    }
+
     auto fastOptions = detail::toFastomlOptions(options);
     fastOptions.flags &= ~FASTOML_PARSE_VALIDATE_ONLY;
 
@@ -96,8 +381,6 @@ auto parse(std::string_view toml, ParseOptions options) -> Result<Document> {
             Error{ErrorCode::OutOfMemory, "Failed to create fastoml parser instance."});
     }
 
-    auto impl = std::make_unique<Document::Impl>();
-    impl->source = std::string(toml);
     impl->parser = std::move(parser);
 
     const fastoml_document* parsedDocument = nullptr;
@@ -113,10 +396,30 @@ auto parse(std::string_view toml, ParseOptions options) -> Result<Document> {
     }
 
     impl->document = parsedDocument;
+    impl->sourceMap.setSource(impl->source);
     return Document(std::move(impl));
 }
 
+auto parse(std::string_view toml, ParseOptions options) -> Result<Document> {
+    auto size = detail::checkSourceSize(toml);
+    if (!size) {
+        return makeUnexpected<Document>(size.error());
+    }
+
+    return Document::parseOwned(options, [toml](std::pmr::string& source) -> Result<void> {
+        source.assign(toml);
+        return {};
+    });
+}
+
 auto validate(std::string_view toml, ParseOptions options) -> Result<void> {
+    FASTOML_CPP_INSTRUMENT(Operation::Validate, toml.size());
+
+    auto size = detail::checkSourceSize(toml);
+    if (!size) {
+        return size;
+    }
+
     auto fastOptions = detail::toFastomlOptions(options);
     fastOptions.flags |= FASTOML_PARSE_VALIDATE_ONLY;
 
@@ -126,7 +429,7 @@ auto validate(std::string_view toml, ParseOptions options) -> Result<void> {
     }
 
     fastoml_error parseError{};
-    const auto source = std::string(toml);
+    const auto source = std::pmr::string(toml, sourceResource(options));
     const auto status = fastoml_validate(parser.get(), source.data(), source.size(), &parseError);
     if (status != FASTOML_OK) {
         return makeUnexpected<void>(detail::toError(status, &parseError, "Validation failed"));
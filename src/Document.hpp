@@ -1,17 +1,26 @@
 #pragma once
 
+#include "CompiledPath.hpp"
+#include "Instrumentation.hpp"
 #include "NodeView.hpp"
 #include "Options.hpp"
 #include "PathRef.hpp"
 
+#include <functional>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace Fastoml {
 
 class Document {
 public:
-    Document() = default;
+    Document() noexcept;
     ~Document();
 
     Document(Document&& other) noexcept;
@@ -23,6 +32,15 @@ public:
     [[nodiscard]] auto isValid() const noexcept -> bool;
     [[nodiscard]] auto root() const -> Result<NodeView>;
     [[nodiscard]] auto get(std::string_view dotPath) const -> Result<NodeView>;
+    [[nodiscard]] auto find(std::string_view dotPath) const noexcept -> NodeView;
+    [[nodiscard]] auto find(const CompiledPath& path) const noexcept -> NodeView;
+    [[nodiscard]] auto getMany(const CompiledPathSet& paths, std::span<NodeView> output) const -> Result<std::size_t>;
+    [[nodiscard]] auto getMany(std::span<const CompiledPath> paths, std::span<NodeView> output) const
+        -> Result<std::size_t>;
+    [[nodiscard]] auto getMany(std::span<const CompiledPath> paths) const -> Result<std::vector<NodeView>>;
+    [[nodiscard]] auto stats() const -> Result<DocumentStats>;
+    [[nodiscard]] auto source() const noexcept -> std::string_view;
+    [[nodiscard]] auto reparse(std::string_view toml) -> Result<void>;
 
     template <FixedString Path>
     [[nodiscard]] auto ref() const -> Result<NodeView> {
@@ -36,13 +54,52 @@ public:
         return get(Ref.view());
     }
 
+    template <typename T>
+    [[nodiscard]] auto tryGet(std::string_view dotPath) const -> std::optional<T> {
+        return find(dotPath).template tryAs<T>();
+    }
+
+    template <typename T, FixedString Path>
+    [[nodiscard]] auto tryGet() const -> std::optional<T> {
+        return tryGet<T>(Path.view());
+    }
+
+    template <typename T, auto Ref>
+    [[nodiscard]] auto tryGet() const -> std::optional<T>
+        requires requires { Ref.view(); }
+    {
+        return tryGet<T>(Ref.view());
+    }
+
+    template <typename T>
+    [[nodiscard]] auto getOr(std::string_view dotPath, T fallback) const -> T {
+        return find(dotPath).template valueOr<T>(std::move(fallback));
+    }
+
+    template <typename T, FixedString Path>
+    [[nodiscard]] auto getOr(T fallback) const -> T {
+        return getOr<T>(Path.view(), std::move(fallback));
+    }
+
+    template <typename T, auto Ref>
+    [[nodiscard]] auto getOr(T fallback) const -> T
+        requires requires { Ref.view(); }
+    {
+        return getOr<T>(Ref.view(), std::move(fallback));
+    }
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl_;
 
+    using SourceWriter = std::function<Result<void>(std::pmr::string&)>;
+
     explicit Document(std::unique_ptr<Impl> impl) noexcept;
 
+    [[nodiscard]] static auto parseOwned(ParseOptions options, const SourceWriter& writeSource) -> Result<Document>;
+
     friend auto parse(std::string_view toml, ParseOptions options) -> Result<Document>;
+    friend class Builder;
 };
 
 [[nodiscard]] auto parse(std::string_view toml, ParseOptions options = {}) -> Result<Document>;
@@ -0,0 +1,170 @@
+#include "DocumentStream.hpp"
+
+#include "Async.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace Fastoml {
+
+namespace {
+
+auto findDelimiter(std::string_view text, std::string_view delimiter, std::size_t from) noexcept -> std::size_t {
+    const auto* begin = text.data();
+    const auto* cursor = begin + from;
+    const auto* last = begin + text.size();
+    while (static_cast<std::size_t>(last - cursor) >= delimiter.size()) {
+        const auto remaining = static_cast<std::size_t>(last - cursor) - delimiter.size() + 1u;
+        const auto* candidate = static_cast<const char*>(std::memchr(cursor, delimiter.front(), remaining));
+        if (candidate == nullptr) {
+            break;
+        }
+        if (std::memcmp(candidate + 1, delimiter.data() + 1, delimiter.size() - 1u) == 0) {
+            return static_cast<std::size_t>(candidate - begin);
+        }
+        cursor = candidate + 1;
+    }
+    return text.size();
+}
+
+auto isBlank(std::string_view record) noexcept -> bool {
+    return record.find_first_not_of(" \t\r\n") == std::string_view::npos;
+}
+
+} // namespace
+
+DocumentStream::Iterator::Iterator(DocumentStream* stream) : stream_(stream) {
+    ++*this;
+}
+
+auto DocumentStream::Iterator::operator*() const -> value_type& {
+    return *current_;
+}
+
+auto DocumentStream::Iterator::operator++() -> Iterator& {
+    if (stream_ == nullptr || stream_->done()) {
+        current_.reset();
+    } else if (current_.has_value() && current_->has_value()) {
+        auto status = stream_->nextInto(**current_);
+        if (!status) {
+            current_.emplace(makeUnexpected<Document>(status.error()));
+        }
+    } else {
+        current_.emplace(stream_->next());
+    }
+    return *this;
+}
+
+auto DocumentStream::Iterator::operator++(int) -> void {
+    ++*this;
+}
+
+auto DocumentStream::Iterator::operator==(std::default_sentinel_t) const noexcept -> bool {
+    return !current_.has_value();
+}
+
+DocumentStream::DocumentStream(std::string_view buffer, std::string_view delimiter, ParseOptions options)
+    : buffer_(buffer), delimiter_(delimiter), options_(options) {
+    skipBlankRecords();
+}
+
+DocumentStream::DocumentStream(std::string owned, std::string_view delimiter, ParseOptions options)
+    : owned_(std::move(owned)), delimiter_(delimiter), options_(options) {
+    skipBlankRecords();
+}
+
+auto DocumentStream::open(const std::filesystem::path& path, std::string_view delimiter, ParseOptions options)
+    -> Result<DocumentStream> {
+    auto text = detail::readFile(path);
+    if (!text) {
+        return makeUnexpected<DocumentStream>(text.error());
+    }
+    return DocumentStream(std::move(*text), delimiter, options);
+}
+
+auto DocumentStream::view() const noexcept -> std::string_view {
+    return buffer_.data() != nullptr ? buffer_ : std::string_view(owned_);
+}
+
+auto DocumentStream::done() const noexcept -> bool {
+    return position_ >= view().size();
+}
+
+auto DocumentStream::recordIndex() const noexcept -> std::size_t {
+    return index_;
+}
+
+auto DocumentStream::skipBlankRecords() noexcept -> void {
+    const auto text = view();
+    while (position_ < text.size()) {
+        const auto end = delimiter_.empty() ? text.size() : findDelimiter(text, delimiter_, position_);
+        if (!isBlank(text.substr(position_, end - position_))) {
+            return;
+        }
+        position_ = end == text.size() ? end : end + delimiter_.size();
+    }
+}
+
+auto DocumentStream::nextRecord() noexcept -> std::string_view {
+    const auto text = view();
+    if (position_ >= text.size()) {
+        return {};
+    }
+
+    const auto end = delimiter_.empty() ? text.size() : findDelimiter(text, delimiter_, position_);
+    const auto record = text.substr(position_, end - position_);
+    position_ = end == text.size() ? end : end + delimiter_.size();
+    ++index_;
+    skipBlankRecords();
+    return record;
+}
+
+auto DocumentStream::next() -> Result<Document> {
+    Document document;
+    auto status = nextInto(document);
+    if (!status) {
+        return makeUnexpected<Document>(status.error());
+    }
+    return document;
+}
+
+auto DocumentStream::nextInto(Document& target) -> Result<void> {
+    if (done()) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Document stream has no more records."});
+    }
+
+    const auto index = index_;
+    return loadRecord(target, nextRecord(), options_, index);
+}
+
+auto DocumentStream::loadRecord(Document& scratch, std::string_view record, const ParseOptions& options,
+                                std::size_t index) -> Result<void> {
+    if (scratch.isValid()) {
+        auto status = scratch.reparse(record);
+        if (!status) {
+            auto error = status.error();
+            error.index = index;
+            return makeUnexpected<void>(error);
+        }
+        return {};
+    }
+
+    auto document = parse(record, options);
+    if (!document) {
+        auto error = document.error();
+        error.index = index;
+        return makeUnexpected<void>(error);
+    }
+    scratch = std::move(*document);
+    return {};
+}
+
+auto DocumentStream::begin() -> Iterator {
+    return Iterator(this);
+}
+
+auto DocumentStream::end() const noexcept -> std::default_sentinel_t {
+    return std::default_sentinel;
+}
+
+} // namespace Fastoml
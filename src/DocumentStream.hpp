@@ -0,0 +1,149 @@
+#pragma once
+
+#include "Document.hpp"
+#include "StructConvert.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Fastoml {
+
+class DocumentStream {
+public:
+    class Iterator {
+    public:
+        // Each step reparses into the held Document unless it was moved out, so keep a record by moving it.
+        using value_type = Result<Document>;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        explicit Iterator(DocumentStream* stream);
+
+        [[nodiscard]] auto operator*() const -> value_type&;
+        auto operator++() -> Iterator&;
+        auto operator++(int) -> void;
+        [[nodiscard]] auto operator==(std::default_sentinel_t) const noexcept -> bool;
+
+    private:
+        DocumentStream* stream_ = nullptr;
+        mutable std::optional<value_type> current_;
+    };
+
+    DocumentStream(std::string_view buffer, std::string_view delimiter, ParseOptions options = {});
+
+    [[nodiscard]] static auto open(const std::filesystem::path& path, std::string_view delimiter,
+                                   ParseOptions options = {}) -> Result<DocumentStream>;
+
+    [[nodiscard]] auto done() const noexcept -> bool;
+    [[nodiscard]] auto recordIndex() const noexcept -> std::size_t;
+    [[nodiscard]] auto nextRecord() noexcept -> std::string_view;
+
+    [[nodiscard]] auto next() -> Result<Document>;
+    [[nodiscard]] auto nextInto(Document& target) -> Result<void>;
+
+    template <typename T>
+    [[nodiscard]] auto nextAs() -> Result<T>
+        requires ModelDefined<T>
+    {
+        if (done()) {
+            return makeUnexpected<T>(Error{ErrorCode::InvalidState, "Document stream has no more records."});
+        }
+
+        const auto index = index_;
+        return decodeRecord<T>(scratch_, nextRecord(), options_, index);
+    }
+
+    template <typename T>
+    [[nodiscard]] auto collect(std::size_t workers = 0u) -> Result<std::vector<T>>
+        requires ModelDefined<T>
+    {
+        const auto firstIndex = index_;
+        std::vector<std::string_view> records;
+        while (!done()) {
+            records.push_back(nextRecord());
+        }
+
+        if (workers == 0u) {
+            workers = std::max(1u, std::thread::hardware_concurrency());
+        }
+        workers = std::min(workers, records.size());
+        if (options_.memoryResource != nullptr) {
+            // pmr resources are not required to be thread-safe.
+            workers = 1u;
+        }
+
+        std::vector<std::optional<Result<T>>> slots(records.size());
+        if (workers <= 1u) {
+            for (std::size_t i = 0u; i < records.size(); ++i) {
+                slots[i].emplace(decodeRecord<T>(scratch_, records[i], options_, firstIndex + i));
+            }
+        } else {
+            std::vector<std::jthread> threads;
+            threads.reserve(workers);
+            for (std::size_t worker = 0u; worker < workers; ++worker) {
+                threads.emplace_back([&, worker] {
+                    Document scratch;
+                    for (auto i = worker; i < records.size(); i += workers) {
+                        slots[i].emplace(decodeRecord<T>(scratch, records[i], options_, firstIndex + i));
+                    }
+                });
+            }
+        }
+
+        std::vector<T> out;
+        out.reserve(slots.size());
+        for (auto& slot : slots) {
+            if (!*slot) {
+                return makeUnexpected<std::vector<T>>(slot->error());
+            }
+            out.push_back(std::move(**slot));
+        }
+        return out;
+    }
+
+    [[nodiscard]] auto begin() -> Iterator;
+    [[nodiscard]] auto end() const noexcept -> std::default_sentinel_t;
+
+private:
+    std::string owned_;
+    std::string_view buffer_;
+    std::string delimiter_;
+    ParseOptions options_;
+    std::size_t position_ = 0u;
+    std::size_t index_ = 0u;
+    Document scratch_;
+
+    DocumentStream(std::string owned, std::string_view delimiter, ParseOptions options);
+
+    [[nodiscard]] auto view() const noexcept -> std::string_view;
+    auto skipBlankRecords() noexcept -> void;
+
+    [[nodiscard]] static auto loadRecord(Document& scratch, std::string_view record, const ParseOptions& options,
+                                         std::size_t index) -> Result<void>;
+
+    template <typename T>
+    [[nodiscard]] static auto decodeRecord(Document& scratch, std::string_view record, const ParseOptions& options,
+                                           std::size_t index) -> Result<T> {
+        auto status = loadRecord(scratch, record, options, index);
+        if (!status) {
+            return makeUnexpected<T>(status.error());
+        }
+
+        auto value = decode<T>(scratch);
+        if (!value) {
+            auto error = value.error();
+            error.index = index;
+            return makeUnexpected<T>(error);
+        }
+        return value;
+    }
+};
+
+} // namespace Fastoml
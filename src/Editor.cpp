@@ -0,0 +1,168 @@
+#include "Editor.hpp"
+
+#include "detail/CInterop.hpp"
+#include "detail/TomlFormat.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace Fastoml {
+
+Editor::Editor(const Document& document) noexcept : document_(&document) {
+}
+
+auto Editor::set(std::string_view dotPath, bool value) -> Result<void> {
+    return replace(dotPath, value ? "true" : "false");
+}
+
+auto Editor::set(std::string_view dotPath, std::int64_t value) -> Result<void> {
+    std::string text;
+    detail::appendTomlInt(text, value);
+    return replace(dotPath, std::move(text));
+}
+
+auto Editor::set(std::string_view dotPath, double value) -> Result<void> {
+    std::string text;
+    detail::appendTomlFloat(text, value);
+    return replace(dotPath, std::move(text));
+}
+
+auto Editor::set(std::string_view dotPath, std::string_view value) -> Result<void> {
+    std::string text;
+    detail::appendTomlString(text, value);
+    return replace(dotPath, std::move(text));
+}
+
+auto Editor::set(std::string_view dotPath, const char* value) -> Result<void> {
+    if (value == nullptr) {
+        return makeUnexpected<void>(keyError(ErrorCode::InvalidState, "Cannot set a null string value.", dotPath));
+    }
+    return set(dotPath, std::string_view(value));
+}
+
+auto Editor::setRaw(std::string_view dotPath, std::string_view tomlValue) -> Result<void> {
+    constexpr std::string_view prefix = "v = ";
+    constexpr std::string_view whitespace = " \t\r\n";
+
+    const auto first = tomlValue.find_first_not_of(whitespace);
+    const auto last = tomlValue.find_last_not_of(whitespace);
+    const auto value =
+        first == std::string_view::npos ? std::string_view{} : tomlValue.substr(first, last - first + 1u);
+
+    std::string probe(prefix);
+    probe += value;
+    auto parsed = parse(probe);
+    if (!parsed) {
+        auto error = keyError(ErrorCode::Syntax, "Replacement is not a single valid TOML value.", dotPath);
+        error.status = parsed.error().status;
+        return makeUnexpected<void>(error);
+    }
+
+    // The probe must define nothing but "v", and v's own text must be the whole replacement, which rules out
+    // injected keys, table headers and trailing comments.
+    const auto root = parsed->root();
+    const auto node = root ? root->find("v") : NodeView{};
+    const auto span = node.valid() ? detail::nodeSource(node.raw()) : std::string_view{};
+    if (!root || root->size() != 1u || span.data() != probe.data() + prefix.size() || span.size() != value.size()) {
+        return makeUnexpected<void>(
+            keyError(ErrorCode::Syntax, "Replacement must be exactly one TOML value.", dotPath));
+    }
+    return replace(dotPath, std::string(value));
+}
+
+auto Editor::editCount() const noexcept -> std::size_t {
+    return edits_.size();
+}
+
+auto Editor::clear() noexcept -> void {
+    edits_.clear();
+}
+
+auto Editor::replace(std::string_view dotPath, std::string replacement) -> Result<void> {
+    if (document_ == nullptr || !document_->isValid()) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Editor is not attached to a parsed document."});
+    }
+
+    auto node = document_->get(dotPath);
+    if (!node) {
+        return makeUnexpected<void>(node.error());
+    }
+    if (node->kind() == NodeKind::Table) {
+        return makeUnexpected<void>(
+            keyError(ErrorCode::UnsupportedType, "Editor can only replace values, not whole tables.", dotPath));
+    }
+    // An array of tables is spread over several `[[x]]` sections, so no single span can be replaced.
+    if (node->kind() == NodeKind::Array && detail::inlineNodeSource(node->raw()).empty()) {
+        return makeUnexpected<void>(keyError(ErrorCode::UnsupportedType,
+                                             "Editor can only replace inline arrays, not arrays of tables.", dotPath));
+    }
+
+    const auto source = document_->source();
+    const auto span = detail::nodeSource(node->raw());
+    if (span.data() == nullptr || span.data() < source.data() ||
+        span.data() + span.size() > source.data() + source.size()) {
+        return makeUnexpected<void>(
+            keyError(ErrorCode::UnsupportedType, "fastoml did not report a source span for this value.", dotPath));
+    }
+
+    Edit edit;
+    edit.offset = static_cast<std::size_t>(span.data() - source.data());
+    edit.length = span.size();
+    edit.replacement = std::move(replacement);
+
+    const auto position = std::lower_bound(edits_.begin(), edits_.end(), edit.offset,
+                                           [](const Edit& lhs, std::size_t offset) { return lhs.offset < offset; });
+    if (position != edits_.end() && position->offset == edit.offset && position->length == edit.length) {
+        position->replacement = std::move(edit.replacement);
+        return {};
+    }
+    if (position != edits_.end() && position->offset < edit.offset + edit.length) {
+        return makeUnexpected<void>(
+            keyError(ErrorCode::InvalidState, "Edit overlaps a previously recorded edit.", dotPath));
+    }
+    if (position != edits_.begin()) {
+        const auto& previous = *(position - 1);
+        if (previous.offset + previous.length > edit.offset) {
+            return makeUnexpected<void>(
+                keyError(ErrorCode::InvalidState, "Edit overlaps a previously recorded edit.", dotPath));
+        }
+    }
+
+    edits_.insert(position, std::move(edit));
+    return {};
+}
+
+auto Editor::toString(std::string& output) const -> Result<void> {
+    if (document_ == nullptr || !document_->isValid()) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Editor is not attached to a parsed document."});
+    }
+
+    const auto source = document_->source();
+    auto size = source.size();
+    for (const auto& edit : edits_) {
+        size = size - edit.length + edit.replacement.size();
+    }
+
+    output.clear();
+    output.reserve(size);
+
+    std::size_t copied = 0u;
+    for (const auto& edit : edits_) {
+        output.append(source.data() + copied, edit.offset - copied);
+        output += edit.replacement;
+        copied = edit.offset + edit.length;
+    }
+    output.append(source.data() + copied, source.size() - copied);
+    return {};
+}
+
+auto Editor::toString() const -> Result<std::string> {
+    std::string output;
+    auto status = toString(output);
+    if (!status) {
+        return makeUnexpected<std::string>(status.error());
+    }
+    return output;
+}
+
+} // namespace Fastoml
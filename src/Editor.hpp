@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Document.hpp"
+#include "Error.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Fastoml {
+
+class Editor {
+public:
+    explicit Editor(const Document& document) noexcept;
+
+    [[nodiscard]] auto set(std::string_view dotPath, bool value) -> Result<void>;
+    [[nodiscard]] auto set(std::string_view dotPath, std::int64_t value) -> Result<void>;
+    [[nodiscard]] auto set(std::string_view dotPath, double value) -> Result<void>;
+    [[nodiscard]] auto set(std::string_view dotPath, std::string_view value) -> Result<void>;
+    [[nodiscard]] auto set(std::string_view dotPath, const char* value) -> Result<void>;
+
+    template <typename T>
+    [[nodiscard]] auto set(std::string_view dotPath, T value) -> Result<void>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, std::int64_t>)
+    {
+        if constexpr (std::is_unsigned_v<T>) {
+            if (value > static_cast<T>((std::numeric_limits<std::int64_t>::max)())) {
+                return makeUnexpected<void>(keyError(
+                    ErrorCode::Overflow, "Unsigned integer conversion overflow while editing value.", dotPath));
+            }
+        }
+        return set(dotPath, static_cast<std::int64_t>(value));
+    }
+
+    [[nodiscard]] auto setRaw(std::string_view dotPath, std::string_view tomlValue) -> Result<void>;
+
+    [[nodiscard]] auto editCount() const noexcept -> std::size_t;
+    auto clear() noexcept -> void;
+
+    [[nodiscard]] auto toString(std::string& output) const -> Result<void>;
+    [[nodiscard]] auto toString() const -> Result<std::string>;
+
+private:
+    struct Edit {
+        std::size_t offset = 0u;
+        std::size_t length = 0u;
+        std::string replacement;
+    };
+
+    const Document* document_ = nullptr;
+    std::vector<Edit> edits_;
+
+    [[nodiscard]] auto replace(std::string_view dotPath, std::string replacement) -> Result<void>;
+};
+
+} // namespace Fastoml
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "detail/Hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace Fastoml {
+
+template <typename E>
+struct EnumEntry {
+    std::string_view name;
+    E value;
+};
+
+template <typename E>
+struct EnumModel;
+
+template <typename E>
+concept EnumModelDefined = std::is_enum_v<E> && requires { EnumModel<E>::entries(); };
+
+template <typename V>
+struct VariantModel;
+
+namespace detail {
+
+template <typename T>
+struct IsVariant : std::false_type {};
+
+template <typename... Alternatives>
+struct IsVariant<std::variant<Alternatives...>> : std::true_type {};
+
+} // namespace detail
+
+template <typename V>
+concept VariantModelDefined = detail::IsVariant<V>::value && requires {
+    { VariantModel<V>::tagKey } -> std::convertible_to<std::string_view>;
+    VariantModel<V>::tags();
+} && VariantModel<V>::tags().size() == std::variant_size_v<V>;
+
+namespace detail {
+
+[[nodiscard]] constexpr auto nameSlot(std::uint64_t hash, std::uint32_t displacement) noexcept -> std::uint32_t {
+    auto x = static_cast<std::uint32_t>(hash >> 32u) ^ (displacement * 0x9E3779B9u);
+    x ^= x >> 16u;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15u;
+    return x;
+}
+
+// Hash-and-displace perfect hash: the low hash bits pick a bucket, whose displacement then places every name
+// of that bucket in a distinct slot. A lookup is one string hash, two table loads and one compare.
+template <std::size_t N>
+struct NameTable {
+    static_assert(N > 0u && N < 0xFFFFu, "Name tables hold between 1 and 65534 names.");
+
+    static constexpr std::size_t bucketCount = std::bit_ceil(N);
+    static constexpr std::size_t slotCount = std::bit_ceil(N) * 2u;
+
+    std::array<std::string_view, N> names{};
+    std::array<std::uint32_t, bucketCount> displacements{};
+    std::array<std::uint16_t, slotCount> slots{};
+
+    [[nodiscard]] constexpr auto find(std::string_view name) const noexcept -> std::size_t {
+        const auto hash = nameHash(name);
+        const auto displacement = displacements[hash & (bucketCount - 1u)];
+        const auto slot = slots[nameSlot(hash, displacement) & (slotCount - 1u)];
+        return slot != 0u && names[slot - 1u] == name ? slot - 1u : N;
+    }
+};
+
+// Deliberately not constexpr: reaching it makes the table construction ill-formed at compile time.
+auto nameTableError(const char* reason) -> void;
+
+template <std::size_t N>
+[[nodiscard]] consteval auto makeNameTable(const std::array<std::string_view, N>& names) -> NameTable<N> {
+    using Table = NameTable<N>;
+    constexpr auto bucketMask = Table::bucketCount - 1u;
+    constexpr auto slotMask = Table::slotCount - 1u;
+
+    Table table;
+    table.names = names;
+
+    std::array<std::uint64_t, N> hashes{};
+    for (std::size_t i = 0u; i < N; ++i) {
+        hashes[i] = nameHash(names[i]);
+    }
+
+    // Names grouped by bucket, largest buckets first; equal names end up adjacent within a bucket.
+    std::array<std::size_t, Table::bucketCount> bucketSizes{};
+    for (const auto hash : hashes) {
+        ++bucketSizes[hash & bucketMask];
+    }
+    std::array<std::size_t, N> order{};
+    std::iota(order.begin(), order.end(), std::size_t{0u});
+    std::ranges::sort(order, [&](std::size_t lhs, std::size_t rhs) {
+        const auto lhsBucket = hashes[lhs] & bucketMask;
+        const auto rhsBucket = hashes[rhs] & bucketMask;
+        if (bucketSizes[lhsBucket] != bucketSizes[rhsBucket]) {
+            return bucketSizes[lhsBucket] > bucketSizes[rhsBucket];
+        }
+        if (lhsBucket != rhsBucket) {
+            return lhsBucket < rhsBucket;
+        }
+        return hashes[lhs] < hashes[rhs];
+    });
+    for (std::size_t i = 1u; i < N; ++i) {
+        if (hashes[order[i]] == hashes[order[i - 1u]] && names[order[i]] == names[order[i - 1u]]) {
+            nameTableError("Duplicate name in enum or variant table.");
+        }
+    }
+
+    for (std::size_t first = 0u; first < N;) {
+        const auto bucket = hashes[order[first]] & bucketMask;
+        const auto last = first + bucketSizes[bucket];
+
+        for (std::uint32_t displacement = 0u;; ++displacement) {
+            if (displacement > (1u << 20u)) {
+                nameTableError("No perfect hash displacement found.");
+            }
+
+            auto placed = first;
+            for (; placed < last; ++placed) {
+                const auto slot = nameSlot(hashes[order[placed]], displacement) & slotMask;
+                if (table.slots[slot] != 0u) {
+                    break;
+                }
+                table.slots[slot] = static_cast<std::uint16_t>(order[placed] + 1u);
+            }
+            if (placed == last) {
+                table.displacements[bucket] = displacement;
+                break;
+            }
+            for (auto undo = first; undo < placed; ++undo) {
+                table.slots[nameSlot(hashes[order[undo]], displacement) & slotMask] = 0u;
+            }
+        }
+        first = last;
+    }
+    return table;
+}
+
+template <typename E>
+[[nodiscard]] consteval auto enumNames() {
+    constexpr auto entries = EnumModel<E>::entries();
+    std::array<std::string_view, entries.size()> names{};
+    for (std::size_t i = 0u; i < entries.size(); ++i) {
+        names[i] = entries[i].name;
+    }
+    return names;
+}
+
+template <typename E>
+inline constexpr auto enumNameTable = makeNameTable(enumNames<E>());
+
+template <typename V>
+inline constexpr auto variantTagTable = makeNameTable(VariantModel<V>::tags());
+
+} // namespace detail
+
+template <typename E>
+[[nodiscard]] constexpr auto enumFromName(std::string_view name) noexcept -> std::optional<E>
+    requires EnumModelDefined<E>
+{
+    constexpr auto entries = EnumModel<E>::entries();
+    const auto index = detail::enumNameTable<E>.find(name);
+    if (index == entries.size()) {
+        return std::nullopt;
+    }
+    return entries[index].value;
+}
+
+template <typename E>
+[[nodiscard]] constexpr auto enumName(E value) noexcept -> std::string_view
+    requires EnumModelDefined<E>
+{
+    constexpr auto entries = EnumModel<E>::entries();
+    for (const auto& entry : entries) {
+        if (entry.value == value) {
+            return entry.name;
+        }
+    }
+    return {};
+}
+
+} // namespace Fastoml
+
+#define FASTOML_CPP_ENUM_VALUE(TYPE, VALUE, NAME_LITERAL) ::Fastoml::EnumEntry<TYPE>{NAME_LITERAL, TYPE::VALUE}
+#define FASTOML_CPP_ENUM(TYPE, ...)                                                                            \
+    template <>                                                                                                \
+    struct Fastoml::EnumModel<TYPE> {                                                                          \
+        static constexpr auto entries() {                                                                      \
+            return std::array{__VA_ARGS__};                                                                    \
+        }                                                                                                      \
+    }
+#define FASTOML_CPP_VARIANT(TYPE, TAG_KEY_LITERAL, ...)                                                        \
+    template <>                                                                                                \
+    struct Fastoml::VariantModel<TYPE> {                                                                       \
+        static constexpr std::string_view tagKey = TAG_KEY_LITERAL;                                            \
+        static constexpr auto tags() {                                                                         \
+            return std::to_array<std::string_view>({__VA_ARGS__});                                             \
+        }                                                                                                      \
+    }
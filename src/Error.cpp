@@ -0,0 +1,53 @@
+#include "Error.hpp"
+
+#include <fastoml.h>
+
+#include <functional>
+#include <limits>
+
+namespace Fastoml {
+
+auto Error::key(std::string_view input) const noexcept -> std::string_view {
+    if (keySize == 0u || keyOffset > input.size() || keySize > input.size() - keyOffset) {
+        return {};
+    }
+    return input.substr(keyOffset, keySize);
+}
+
+auto Error::message() const -> std::string {
+    return message({});
+}
+
+auto Error::message(std::string_view input) const -> std::string {
+    std::string out(summary != nullptr ? summary : "");
+    if (status != 0) {
+        out += ": ";
+        out += fastoml_status_string(static_cast<fastoml_status>(status));
+    }
+    if (const auto offending = key(input); !offending.empty()) {
+        out += ": ";
+        out += offending;
+    }
+    return out;
+}
+
+auto keyError(ErrorCode code, const char* summary, std::string_view input, std::string_view key) noexcept -> Error {
+    Error out{code, summary};
+    const auto begin = input.data();
+    const auto inside = std::less_equal<>{}(begin, key.data()) &&
+                        std::less_equal<>{}(key.data() + key.size(), begin + input.size());
+    const auto offset = inside ? static_cast<std::size_t>(key.data() - begin) : 0u;
+    const auto size = inside ? key.size() : input.size();
+    constexpr auto limit = (std::numeric_limits<std::uint32_t>::max)();
+    if (offset <= limit && size <= limit) {
+        out.keyOffset = static_cast<std::uint32_t>(offset);
+        out.keySize = static_cast<std::uint32_t>(size);
+    }
+    return out;
+}
+
+auto keyError(ErrorCode code, const char* summary, std::string_view input) noexcept -> Error {
+    return keyError(code, summary, input, input);
+}
+
+} // namespace Fastoml
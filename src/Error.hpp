@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <expected>
 #include <string>
+#include <string_view>
 #include <utility>
 
 namespace Fastoml {
@@ -20,16 +22,30 @@ enum class ErrorCode {
     InvalidPath,
     InvalidState,
     UnsupportedType,
+    Io,
 };
 
 struct Error {
     ErrorCode code = ErrorCode::Ok;
-    std::string message;
-    std::uint32_t byteOffset = 0u;
-    std::uint32_t line = 0u;
-    std::uint32_t column = 0u;
+    const char* summary = "";
+    int status = 0;
+    std::uint32_t keyOffset = 0u;
+    std::uint32_t keySize = 0u;
+    std::uint64_t byteOffset = 0u;
+    std::uint64_t line = 0u;
+    std::uint64_t column = 0u;
+    std::size_t index = 0u;
+
+    // The offending key is stored as a span of the path or key argument passed to the failing call.
+    [[nodiscard]] auto key(std::string_view input) const noexcept -> std::string_view;
+    [[nodiscard]] auto message() const -> std::string;
+    [[nodiscard]] auto message(std::string_view input) const -> std::string;
 };
 
+[[nodiscard]] auto keyError(ErrorCode code, const char* summary, std::string_view input, std::string_view key) noexcept
+    -> Error;
+[[nodiscard]] auto keyError(ErrorCode code, const char* summary, std::string_view input) noexcept -> Error;
+
 template <typename T>
 using Result = std::expected<T, Error>;
 
@@ -1,9 +1,21 @@
 #pragma once
 
+#include "Async.hpp"
 #include "Builder.hpp"
+#include "Diff.hpp"
 #include "Document.hpp"
+#include "DocumentStream.hpp"
+#include "Editor.hpp"
 #include "Error.hpp"
+#include "FlatIndex.hpp"
+#include "Instrumentation.hpp"
+#include "Json.hpp"
+#include "LargeDocument.hpp"
+#include "MergedView.hpp"
 #include "NodeView.hpp"
 #include "Options.hpp"
 #include "PathRef.hpp"
+#include "RuntimeInfo.hpp"
+#include "StringPool.hpp"
 #include "StructConvert.hpp"
+#include "Writer.hpp"
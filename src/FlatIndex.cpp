@@ -0,0 +1,310 @@
+#include "FlatIndex.hpp"
+
+#include "detail/Hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+namespace Fastoml {
+
+namespace {
+
+constexpr std::array<char, 4> indexMagic = {'F', 'T', 'I', 'X'};
+constexpr std::uint32_t indexVersion = 1u;
+constexpr std::uint32_t byteOrderTag = 0x01020304u;
+constexpr std::size_t notFound = std::numeric_limits<std::size_t>::max();
+
+struct Header {
+    std::array<char, 4> magic{};
+    std::uint32_t version = 0u;
+    std::uint32_t byteOrder = 0u;
+    std::uint32_t reserved = 0u;
+    std::uint64_t count = 0u;
+    std::uint64_t capacity = 0u;
+    std::uint64_t arenaBytes = 0u;
+};
+
+struct FlatEntry {
+    std::string path;
+    NodeKind kind = NodeKind::Unknown;
+    std::uint64_t bits = 0u;
+    std::string_view text;
+};
+
+auto pathHash(std::string_view dotPath) noexcept -> std::uint64_t {
+    // Zero marks an empty slot.
+    return detail::nameHash(dotPath) | 1u;
+}
+
+auto isTextual(NodeKind kind) noexcept -> bool {
+    return kind == NodeKind::String || kind == NodeKind::DateTime || kind == NodeKind::Date || kind == NodeKind::Time;
+}
+
+auto collectEntries(const NodeView& node, std::string& path, std::vector<FlatEntry>& entries) -> Result<void> {
+    const auto kind = node.kind();
+    if (kind == NodeKind::Table || kind == NodeKind::Array) {
+        const auto count = node.size();
+        for (std::size_t i = 0u; i < count; ++i) {
+            auto child = node.at(i);
+            if (!child) {
+                return makeUnexpected<void>(child.error());
+            }
+
+            const auto previousSize = path.size();
+            if (!path.empty()) {
+                path += '.';
+            }
+            if (kind == NodeKind::Table) {
+                auto key = node.keyAt(i);
+                if (!key) {
+                    return makeUnexpected<void>(key.error());
+                }
+                path += *key;
+            } else {
+                path += std::to_string(i);
+            }
+
+            auto status = collectEntries(*child, path, entries);
+            if (!status) {
+                return status;
+            }
+            path.resize(previousSize);
+        }
+        return {};
+    }
+
+    FlatEntry entry;
+    entry.path = path;
+    entry.kind = kind;
+    if (kind == NodeKind::Bool) {
+        auto value = node.asBool();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        entry.bits = *value ? 1u : 0u;
+    } else if (kind == NodeKind::Int) {
+        auto value = node.asInt64();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        entry.bits = static_cast<std::uint64_t>(*value);
+    } else if (kind == NodeKind::Float) {
+        auto value = node.asDouble();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        entry.bits = std::bit_cast<std::uint64_t>(*value);
+    } else if (isTextual(kind)) {
+        auto value = node.asStringView();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        entry.text = *value;
+    } else {
+        return makeUnexpected<void>(Error{ErrorCode::UnsupportedType, "Node kind cannot be flattened."});
+    }
+    entries.push_back(std::move(entry));
+    return {};
+}
+
+template <typename T>
+auto appendArray(std::string& output, const std::vector<T>& values) -> void {
+    output.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename T>
+auto readArray(std::string_view& input, std::vector<T>& values, std::size_t count) -> bool {
+    if (input.size() / sizeof(T) < count) {
+        return false;
+    }
+    values.resize(count);
+    std::memcpy(values.data(), input.data(), count * sizeof(T));
+    input.remove_prefix(count * sizeof(T));
+    return true;
+}
+
+} // namespace
+
+auto FlatIndex::build(const Document& document) -> Result<FlatIndex> {
+    auto rootNode = document.root();
+    if (!rootNode) {
+        return makeUnexpected<FlatIndex>(rootNode.error());
+    }
+    return build(*rootNode);
+}
+
+auto FlatIndex::build(const NodeView& root) -> Result<FlatIndex> {
+    std::vector<FlatEntry> entries;
+    std::string path;
+    auto status = collectEntries(root, path, entries);
+    if (!status) {
+        return makeUnexpected<FlatIndex>(status.error());
+    }
+
+    FlatIndex out;
+    const auto capacity = std::bit_ceil(std::max<std::size_t>(entries.size() * 2u, 8u));
+    out.hashes_.assign(capacity, 0u);
+    out.keyOffsets_.assign(capacity, 0u);
+    out.keyLengths_.assign(capacity, 0u);
+    out.payloads_.assign(capacity, 0u);
+    out.kinds_.assign(capacity, static_cast<std::uint8_t>(NodeKind::Unknown));
+
+    std::size_t arenaBytes = 0u;
+    for (const auto& entry : entries) {
+        arenaBytes += entry.path.size() + entry.text.size();
+    }
+    if (arenaBytes > (std::numeric_limits<std::uint32_t>::max)()) {
+        return makeUnexpected<FlatIndex>(Error{ErrorCode::Overflow, "Flat index string arena exceeds 4 GiB."});
+    }
+    out.arena_.reserve(arenaBytes);
+
+    const auto mask = capacity - 1u;
+    for (const auto& entry : entries) {
+        const auto hash = pathHash(entry.path);
+        auto slot = static_cast<std::size_t>(hash) & mask;
+        while (out.hashes_[slot] != 0u) {
+            if (out.hashes_[slot] == hash &&
+                std::string_view(out.arena_).substr(out.keyOffsets_[slot], out.keyLengths_[slot]) == entry.path) {
+                return makeUnexpected<FlatIndex>(
+                    Error{ErrorCode::DuplicateKey, "Two nodes flatten to the same dot path."});
+            }
+            slot = (slot + 1u) & mask;
+        }
+
+        out.hashes_[slot] = hash;
+        out.keyOffsets_[slot] = static_cast<std::uint32_t>(out.arena_.size());
+        out.keyLengths_[slot] = static_cast<std::uint32_t>(entry.path.size());
+        out.arena_ += entry.path;
+        out.kinds_[slot] = static_cast<std::uint8_t>(entry.kind);
+        if (isTextual(entry.kind)) {
+            out.payloads_[slot] = (static_cast<std::uint64_t>(out.arena_.size()) << 32u) | entry.text.size();
+            out.arena_ += entry.text;
+        } else {
+            out.payloads_[slot] = entry.bits;
+        }
+    }
+    out.count_ = entries.size();
+    return out;
+}
+
+auto FlatIndex::size() const noexcept -> std::size_t {
+    return count_;
+}
+
+auto FlatIndex::slotOf(std::string_view dotPath) const noexcept -> std::size_t {
+    if (hashes_.empty()) {
+        return notFound;
+    }
+
+    const auto hash = pathHash(dotPath);
+    const auto mask = hashes_.size() - 1u;
+    for (auto slot = static_cast<std::size_t>(hash) & mask; hashes_[slot] != 0u; slot = (slot + 1u) & mask) {
+        if (hashes_[slot] == hash && keyLengths_[slot] == dotPath.size() &&
+            std::memcmp(arena_.data() + keyOffsets_[slot], dotPath.data(), dotPath.size()) == 0) {
+            return slot;
+        }
+    }
+    return notFound;
+}
+
+auto FlatIndex::valueAt(std::size_t slot) const noexcept -> FlatValue {
+    FlatValue value;
+    value.kind_ = static_cast<NodeKind>(kinds_[slot]);
+    if (isTextual(value.kind_)) {
+        value.text_ = std::string_view(arena_).substr(payloads_[slot] >> 32u, payloads_[slot] & 0xFFFFFFFFu);
+    } else {
+        value.bits_ = payloads_[slot];
+    }
+    return value;
+}
+
+auto FlatIndex::contains(std::string_view dotPath) const noexcept -> bool {
+    return slotOf(dotPath) != notFound;
+}
+
+auto FlatIndex::find(std::string_view dotPath) const noexcept -> FlatValue {
+    const auto slot = slotOf(dotPath);
+    return slot != notFound ? valueAt(slot) : FlatValue();
+}
+
+auto FlatIndex::get(std::string_view dotPath) const -> Result<FlatValue> {
+    const auto slot = slotOf(dotPath);
+    if (slot == notFound) {
+        return makeUnexpected<FlatValue>(keyError(ErrorCode::KeyNotFound, "Key not found in flat index", dotPath));
+    }
+    return valueAt(slot);
+}
+
+auto FlatIndex::serialize(std::string& output) const -> void {
+    Header header;
+    header.magic = indexMagic;
+    header.version = indexVersion;
+    header.byteOrder = byteOrderTag;
+    header.count = count_;
+    header.capacity = hashes_.size();
+    header.arenaBytes = arena_.size();
+
+    output.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    appendArray(output, hashes_);
+    appendArray(output, keyOffsets_);
+    appendArray(output, keyLengths_);
+    appendArray(output, payloads_);
+    appendArray(output, kinds_);
+    output += arena_;
+}
+
+auto FlatIndex::deserialize(std::string_view bytes) -> Result<FlatIndex> {
+    const auto corrupt = [] {
+        return makeUnexpected<FlatIndex>(Error{ErrorCode::Syntax, "Serialized flat index is malformed."});
+    };
+
+    Header header;
+    if (bytes.size() < sizeof(header)) {
+        return corrupt();
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    bytes.remove_prefix(sizeof(header));
+    if (header.magic != indexMagic || header.version != indexVersion || header.byteOrder != byteOrderTag) {
+        return makeUnexpected<FlatIndex>(
+            Error{ErrorCode::UnsupportedType, "Serialized flat index has an unknown format or byte order."});
+    }
+    if (header.capacity == 0u || !std::has_single_bit(header.capacity) || header.count > header.capacity ||
+        header.capacity > bytes.size() || header.arenaBytes > bytes.size()) {
+        return corrupt();
+    }
+
+    FlatIndex out;
+    const auto capacity = static_cast<std::size_t>(header.capacity);
+    if (!readArray(bytes, out.hashes_, capacity) || !readArray(bytes, out.keyOffsets_, capacity) ||
+        !readArray(bytes, out.keyLengths_, capacity) || !readArray(bytes, out.payloads_, capacity) ||
+        !readArray(bytes, out.kinds_, capacity) || bytes.size() < header.arenaBytes) {
+        return corrupt();
+    }
+    out.arena_.assign(bytes.substr(0u, static_cast<std::size_t>(header.arenaBytes)));
+    out.count_ = static_cast<std::size_t>(header.count);
+
+    std::size_t occupied = 0u;
+    for (std::size_t slot = 0u; slot < capacity; ++slot) {
+        if (out.hashes_[slot] == 0u) {
+            continue;
+        }
+        ++occupied;
+
+        const auto kind = static_cast<NodeKind>(out.kinds_[slot]);
+        const auto keyEnd = std::uint64_t{out.keyOffsets_[slot]} + out.keyLengths_[slot];
+        const auto textEnd = (out.payloads_[slot] >> 32u) + (out.payloads_[slot] & 0xFFFFFFFFu);
+        const auto scalar = kind == NodeKind::Bool || kind == NodeKind::Int || kind == NodeKind::Float;
+        if (keyEnd > out.arena_.size() || (!scalar && !isTextual(kind)) ||
+            (isTextual(kind) && textEnd > out.arena_.size())) {
+            return corrupt();
+        }
+    }
+    if (occupied != out.count_ || occupied == capacity) {
+        return corrupt();
+    }
+    return out;
+}
+
+} // namespace Fastoml
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Document.hpp"
+#include "NodeView.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Fastoml {
+
+class FlatValue {
+public:
+    FlatValue() = default;
+
+    [[nodiscard]] auto valid() const noexcept -> bool {
+        return kind_ != NodeKind::Unknown;
+    }
+
+    [[nodiscard]] auto kind() const noexcept -> NodeKind {
+        return kind_;
+    }
+
+    template <typename T>
+    [[nodiscard]] auto tryAs() const -> std::optional<T> {
+        if constexpr (std::is_same_v<T, bool>) {
+            return kind_ == NodeKind::Bool ? std::optional<T>(bits_ != 0u) : std::nullopt;
+        } else if constexpr (std::is_integral_v<T>) {
+            const auto value = static_cast<std::int64_t>(bits_);
+            if (kind_ != NodeKind::Int || !std::in_range<T>(value)) {
+                return std::nullopt;
+            }
+            return static_cast<T>(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (kind_ == NodeKind::Float) {
+                return static_cast<T>(std::bit_cast<double>(bits_));
+            }
+            if (kind_ == NodeKind::Int) {
+                return static_cast<T>(static_cast<std::int64_t>(bits_));
+            }
+            return std::nullopt;
+        } else if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>) {
+            const auto textual = kind_ == NodeKind::String || kind_ == NodeKind::DateTime || kind_ == NodeKind::Date ||
+                                 kind_ == NodeKind::Time;
+            return textual ? std::optional<T>(T(text_)) : std::nullopt;
+        } else {
+            static_assert(!sizeof(T), "Requested type is not supported by FlatValue::tryAs().");
+        }
+    }
+
+    template <typename T>
+    [[nodiscard]] auto as() const -> Result<T> {
+        auto value = tryAs<T>();
+        if (!value) {
+            if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+                if (kind_ == NodeKind::Int) {
+                    return makeUnexpected<T>(
+                        Error{ErrorCode::Overflow, "Integer conversion overflow while reading value."});
+                }
+            }
+            return makeUnexpected<T>(Error{ErrorCode::Type, "Flat index value has a different type."});
+        }
+        return std::move(*value);
+    }
+
+private:
+    friend class FlatIndex;
+
+    NodeKind kind_ = NodeKind::Unknown;
+    std::uint64_t bits_ = 0u;
+    std::string_view text_;
+};
+
+class FlatIndex {
+public:
+    FlatIndex() = default;
+
+    [[nodiscard]] static auto build(const Document& document) -> Result<FlatIndex>;
+    [[nodiscard]] static auto build(const NodeView& root) -> Result<FlatIndex>;
+    [[nodiscard]] static auto deserialize(std::string_view bytes) -> Result<FlatIndex>;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+    [[nodiscard]] auto contains(std::string_view dotPath) const noexcept -> bool;
+    [[nodiscard]] auto find(std::string_view dotPath) const noexcept -> FlatValue;
+    [[nodiscard]] auto get(std::string_view dotPath) const -> Result<FlatValue>;
+
+    template <typename T>
+    [[nodiscard]] auto getOr(std::string_view dotPath, T fallback) const -> T {
+        auto value = find(dotPath).template tryAs<T>();
+        return value ? std::move(*value) : std::move(fallback);
+    }
+
+    auto serialize(std::string& output) const -> void;
+
+private:
+    std::vector<std::uint64_t> hashes_;
+    std::vector<std::uint32_t> keyOffsets_;
+    std::vector<std::uint32_t> keyLengths_;
+    std::vector<std::uint64_t> payloads_;
+    std::vector<std::uint8_t> kinds_;
+    std::string arena_;
+    std::size_t count_ = 0u;
+
+    [[nodiscard]] auto slotOf(std::string_view dotPath) const noexcept -> std::size_t;
+    [[nodiscard]] auto valueAt(std::size_t slot) const noexcept -> FlatValue;
+};
+
+} // namespace Fastoml
@@ -0,0 +1,76 @@
+#include "Instrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+namespace Fastoml {
+
+namespace {
+
+struct AtomicOperationStats {
+    std::atomic<std::uint64_t> count{0u};
+    std::atomic<std::uint64_t> bytes{0u};
+    std::atomic<std::uint64_t> totalNanoseconds{0u};
+    std::array<std::atomic<std::uint64_t>, latencyBucketCount> latencyBuckets{};
+};
+
+std::array<AtomicOperationStats, operationCount> operationStats;
+std::atomic<InstrumentationSink*> activeSink{nullptr};
+
+auto latencyBucket(std::uint64_t nanoseconds) noexcept -> std::size_t {
+    const auto bucket = static_cast<std::size_t>(std::bit_width(nanoseconds));
+    return (std::min)(bucket, latencyBucketCount - 1u);
+}
+
+} // namespace
+
+auto setInstrumentationSink(InstrumentationSink* sink) noexcept -> void {
+    activeSink.store(sink, std::memory_order_release);
+}
+
+auto instrumentationStats() noexcept -> InstrumentationStats {
+    InstrumentationStats out;
+    for (std::size_t i = 0u; i < operationCount; ++i) {
+        const auto& source = operationStats[i];
+        auto& target = out.operations[i];
+        target.count = source.count.load(std::memory_order_relaxed);
+        target.bytes = source.bytes.load(std::memory_order_relaxed);
+        target.totalNanoseconds = source.totalNanoseconds.load(std::memory_order_relaxed);
+        for (std::size_t bucket = 0u; bucket < latencyBucketCount; ++bucket) {
+            target.latencyBuckets[bucket] = source.latencyBuckets[bucket].load(std::memory_order_relaxed);
+        }
+    }
+    return out;
+}
+
+auto resetInstrumentationStats() noexcept -> void {
+    for (auto& stats : operationStats) {
+        stats.count.store(0u, std::memory_order_relaxed);
+        stats.bytes.store(0u, std::memory_order_relaxed);
+        stats.totalNanoseconds.store(0u, std::memory_order_relaxed);
+        for (auto& bucket : stats.latencyBuckets) {
+            bucket.store(0u, std::memory_order_relaxed);
+        }
+    }
+}
+
+namespace detail {
+
+auto recordOperation(Operation operation, std::uint64_t bytes, std::chrono::nanoseconds elapsed) noexcept -> void {
+    const auto nanoseconds = static_cast<std::uint64_t>((std::max)(elapsed.count(), decltype(elapsed.count()){0}));
+    auto& stats = operationStats[static_cast<std::size_t>(operation)];
+    stats.count.fetch_add(1u, std::memory_order_relaxed);
+    stats.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    stats.totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    stats.latencyBuckets[latencyBucket(nanoseconds)].fetch_add(1u, std::memory_order_relaxed);
+
+    auto* sink = activeSink.load(std::memory_order_acquire);
+    if (sink != nullptr) {
+        sink->onOperation(operation, bytes, elapsed);
+    }
+}
+
+} // namespace detail
+
+} // namespace Fastoml
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef FASTOML_CPP_INSTRUMENTATION
+#define FASTOML_CPP_INSTRUMENTATION 0
+#endif
+
+namespace Fastoml {
+
+enum class Operation {
+    Parse = 0,
+    Validate,
+    Get,
+    Decode,
+    BuilderInsert,
+    Serialize,
+};
+
+inline constexpr std::size_t operationCount = 6u;
+inline constexpr std::size_t latencyBucketCount = 32u;
+
+struct OperationStats {
+    std::uint64_t count = 0u;
+    std::uint64_t bytes = 0u;
+    std::uint64_t totalNanoseconds = 0u;
+    std::array<std::uint64_t, latencyBucketCount> latencyBuckets{};
+};
+
+struct InstrumentationStats {
+    std::array<OperationStats, operationCount> operations{};
+
+    [[nodiscard]] auto operator[](Operation operation) const -> const OperationStats& {
+        return operations[static_cast<std::size_t>(operation)];
+    }
+};
+
+struct DocumentStats {
+    std::size_t nodeCount = 0u;
+    std::size_t sourceBytes = 0u;
+    // Bytes fastoml allocated for this document; always 0 unless FASTOML_CPP_INSTRUMENTATION is enabled.
+    std::size_t arenaBytes = 0u;
+    std::uint32_t maxDepth = 0u;
+};
+
+class InstrumentationSink {
+public:
+    virtual ~InstrumentationSink() = default;
+
+    virtual auto onOperation(Operation operation, std::uint64_t bytes, std::chrono::nanoseconds elapsed) noexcept
+        -> void = 0;
+};
+
+[[nodiscard]] constexpr auto instrumentationEnabled() noexcept -> bool {
+    return FASTOML_CPP_INSTRUMENTATION != 0;
+}
+
+auto setInstrumentationSink(InstrumentationSink* sink) noexcept -> void;
+[[nodiscard]] auto instrumentationStats() noexcept -> InstrumentationStats;
+auto resetInstrumentationStats() noexcept -> void;
+
+namespace detail {
+
+auto recordOperation(Operation operation, std::uint64_t bytes, std::chrono::nanoseconds elapsed) noexcept -> void;
+
+class OperationScope {
+public:
+    OperationScope(Operation operation, std::uint64_t bytes) noexcept
+        : operation_(operation), bytes_(bytes), start_(std::chrono::steady_clock::now()) {
+    }
+
+    ~OperationScope() {
+        recordOperation(operation_, bytes_, std::chrono::steady_clock::now() - start_);
+    }
+
+    OperationScope(const OperationScope&) = delete;
+    auto operator=(const OperationScope&) -> OperationScope& = delete;
+
+    auto setBytes(std::uint64_t bytes) noexcept -> void {
+        bytes_ = bytes;
+    }
+
+private:
+    Operation operation_;
+    std::uint64_t bytes_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace detail
+
+} // namespace Fastoml
+
+#if FASTOML_CPP_INSTRUMENTATION
+#define FASTOML_CPP_INSTRUMENT(OPERATION, BYTES)                                                               \
+    ::Fastoml::detail::OperationScope fastomlOperationScope(OPERATION, static_cast<std::uint64_t>(BYTES))
+#define FASTOML_CPP_INSTRUMENT_BYTES(BYTES) fastomlOperationScope.setBytes(static_cast<std::uint64_t>(BYTES))
+#else
+#define FASTOML_CPP_INSTRUMENT(OPERATION, BYTES) static_cast<void>(0)
+#define FASTOML_CPP_INSTRUMENT_BYTES(BYTES) static_cast<void>(0)
+#endif
@@ -0,0 +1,148 @@
+#include "Json.hpp"
+
+#include "detail/TomlFormat.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Fastoml {
+
+namespace {
+
+template <typename T>
+auto appendNumber(std::string& output, T value) -> void {
+    std::array<char, 32> buffer{};
+    const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    output.append(buffer.data(), result.ptr);
+}
+
+auto appendNode(const NodeView& node, std::string& output) -> Result<void> {
+    switch (node.kind()) {
+    case NodeKind::Table: {
+        output += '{';
+        const auto count = node.size();
+        for (std::size_t i = 0u; i < count; ++i) {
+            auto key = node.keyAt(i);
+            if (!key) {
+                return makeUnexpected<void>(key.error());
+            }
+            auto value = node.at(i);
+            if (!value) {
+                return makeUnexpected<void>(value.error());
+            }
+
+            if (i != 0u) {
+                output += ',';
+            }
+            detail::appendQuotedString(output, *key);
+            output += ':';
+            auto status = appendNode(*value, output);
+            if (!status) {
+                return status;
+            }
+        }
+        output += '}';
+        return {};
+    }
+    case NodeKind::Array: {
+        output += '[';
+        const auto count = node.size();
+        for (std::size_t i = 0u; i < count; ++i) {
+            auto value = node.at(i);
+            if (!value) {
+                return makeUnexpected<void>(value.error());
+            }
+
+            if (i != 0u) {
+                output += ',';
+            }
+            auto status = appendNode(*value, output);
+            if (!status) {
+                return status;
+            }
+        }
+        output += ']';
+        return {};
+    }
+    case NodeKind::Int: {
+        auto value = node.asInt64();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        appendNumber(output, *value);
+        return {};
+    }
+    case NodeKind::Float: {
+        auto value = node.asDouble();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        if (!std::isfinite(*value)) {
+            output += "null";
+        } else {
+            appendNumber(output, *value);
+        }
+        return {};
+    }
+    case NodeKind::Bool: {
+        auto value = node.asBool();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        output += *value ? "true" : "false";
+        return {};
+    }
+    case NodeKind::String:
+    case NodeKind::DateTime:
+    case NodeKind::Date:
+    case NodeKind::Time: {
+        auto value = node.asStringView();
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        detail::appendQuotedString(output, *value);
+        return {};
+    }
+    default:
+        return makeUnexpected<void>(Error{ErrorCode::UnsupportedType, "Node kind cannot be converted to JSON."});
+    }
+}
+
+} // namespace
+
+auto toJson(const NodeView& node, std::string& output) -> Result<void> {
+    output.clear();
+    if (!node.valid()) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Cannot read a null node."});
+    }
+
+    auto status = appendNode(node, output);
+    if (!status) {
+        output.clear();
+    }
+    return status;
+}
+
+auto toJson(const Document& document, std::string& output) -> Result<void> {
+    auto rootNode = document.root();
+    if (!rootNode) {
+        output.clear();
+        return makeUnexpected<void>(rootNode.error());
+    }
+    return toJson(*rootNode, output);
+}
+
+auto toJson(const Document& document) -> Result<std::string> {
+    std::string output;
+    auto status = toJson(document, output);
+    if (!status) {
+        return makeUnexpected<std::string>(status.error());
+    }
+    return output;
+}
+
+} // namespace Fastoml
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Document.hpp"
+#include "NodeView.hpp"
+
+#include <string>
+
+namespace Fastoml {
+
+[[nodiscard]] auto toJson(const NodeView& node, std::string& output) -> Result<void>;
+[[nodiscard]] auto toJson(const Document& document, std::string& output) -> Result<void>;
+[[nodiscard]] auto toJson(const Document& document) -> Result<std::string>;
+
+} // namespace Fastoml
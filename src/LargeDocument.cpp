@@ -0,0 +1,288 @@
+#include "LargeDocument.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+namespace Fastoml {
+
+namespace {
+
+auto skipPast(std::string_view text, std::size_t from, std::string_view terminator, bool escapes) noexcept
+    -> std::size_t {
+    while (from < text.size()) {
+        const auto next = text.find(terminator, from);
+        if (next == std::string_view::npos) {
+            return text.size();
+        }
+
+        std::size_t backslashes = 0u;
+        while (escapes && next > backslashes && text[next - backslashes - 1u] == '\\') {
+            ++backslashes;
+        }
+        if (backslashes % 2u == 0u) {
+            return next + terminator.size();
+        }
+        from = next + 1u;
+    }
+    return text.size();
+}
+
+// A header line, or a key/value line before the first header, together with the top-level key it defines.
+struct RootUse {
+    std::size_t offset = 0u;
+    std::string_view root;
+    bool header = false;
+};
+
+// First key segment starting at `from` (after any '['), with quotes stripped so `"a"` and `a` compare equal.
+auto firstSegment(std::string_view text, std::size_t from) noexcept -> std::string_view {
+    auto i = text.find_first_not_of("[ \t", from);
+    if (i == std::string_view::npos) {
+        return {};
+    }
+    if (text[i] == '"' || text[i] == '\'') {
+        const auto end = skipPast(text, i + 1u, text.substr(i, 1u), text[i] == '"');
+        return text.substr(i + 1u, end > i + 1u ? end - i - 2u : 0u);
+    }
+
+    const auto begin = i;
+    while (i < text.size() && text[i] != '.' && text[i] != ']' && text[i] != '=' && text[i] != ' ' &&
+           text[i] != '\t') {
+        ++i;
+    }
+    return text.substr(begin, i - begin);
+}
+
+// Collects every header line and every top-level key line outside strings and multi-line values.
+auto findRootUses(std::string_view text) -> std::vector<RootUse> {
+    std::vector<RootUse> uses;
+    std::size_t depth = 0u;
+    std::size_t lineStart = 0u;
+    bool atLineStart = true;
+    bool seenHeader = false;
+
+    std::size_t i = 0u;
+    while (i < text.size()) {
+        const auto c = text[i];
+        if (atLineStart && (c == ' ' || c == '\t')) {
+            ++i;
+            continue;
+        }
+
+        if (atLineStart && depth == 0u && c == '[') {
+            uses.push_back(RootUse{lineStart, firstSegment(text, i), true});
+            seenHeader = true;
+            const auto newline = text.find('\n', i);
+            i = newline == std::string_view::npos ? text.size() : newline;
+            continue;
+        }
+        if (atLineStart && depth == 0u && !seenHeader && c != '#' && c != '\r' && c != '\n') {
+            uses.push_back(RootUse{lineStart, firstSegment(text, i), false});
+        }
+        atLineStart = false;
+
+        switch (c) {
+        case '\n':
+            atLineStart = true;
+            lineStart = i + 1u;
+            ++i;
+            break;
+        case '#': {
+            const auto newline = text.find('\n', i);
+            i = newline == std::string_view::npos ? text.size() : newline;
+            break;
+        }
+        case '"':
+            if (text.substr(i, 3u) == "\"\"\"") {
+                i = skipPast(text, i + 3u, "\"\"\"", true);
+            } else {
+                i = skipPast(text, i + 1u, "\"", true);
+            }
+            break;
+        case '\'':
+            if (text.substr(i, 3u) == "\'\'\'") {
+                i = skipPast(text, i + 3u, "\'\'\'", false);
+            } else {
+                i = skipPast(text, i + 1u, "\'", false);
+            }
+            break;
+        case '[':
+        case '{':
+            ++depth;
+            ++i;
+            break;
+        case ']':
+        case '}':
+            depth = depth > 0u ? depth - 1u : 0u;
+            ++i;
+            break;
+        default:
+            ++i;
+            break;
+        }
+    }
+    return uses;
+}
+
+// Returns offsets of header lines where the input may be cut, at least `chunkBytes` apart. MergedView layers parts
+// by shadowing, so every top-level key must live in exactly one part: no cut may fall between the first and last
+// line that uses a root key. That keeps `[a]` with `[a.b]`, `[[items]]` elements with each other, and preamble keys
+// such as `a.b.c = 1` with a later `[a.x]`; the remaining conflicts are then inside one part, where fastoml rejects
+// them.
+auto findCuts(std::string_view text, std::size_t chunkBytes) -> std::vector<std::size_t> {
+    const auto uses = findRootUses(text);
+
+    struct Span {
+        std::size_t first = 0u;
+        std::size_t last = 0u;
+    };
+    std::unordered_map<std::string_view, Span> roots;
+    for (const auto& use : uses) {
+        const auto [entry, inserted] = roots.try_emplace(use.root, Span{use.offset, use.offset});
+        entry->second.last = use.offset;
+    }
+
+    std::vector<Span> blocked;
+    for (const auto& [root, span] : roots) {
+        if (span.first != span.last) {
+            blocked.push_back(span);
+        }
+    }
+    std::ranges::sort(blocked, {}, &Span::first);
+
+    std::vector<std::size_t> cuts;
+    std::size_t lastCut = 0u;
+    std::size_t blockedUntil = 0u;
+    std::size_t next = 0u;
+    for (const auto& use : uses) {
+        while (next < blocked.size() && blocked[next].first < use.offset) {
+            blockedUntil = std::max(blockedUntil, blocked[next].last);
+            ++next;
+        }
+        if (!use.header || use.offset <= blockedUntil || use.offset - lastCut < chunkBytes) {
+            continue;
+        }
+        cuts.push_back(use.offset);
+        lastCut = use.offset;
+    }
+    return cuts;
+}
+
+// Safety net behind findCuts: a top-level key present in two parts would be silently shadowed by MergedView.
+auto checkDisjointParts(const std::vector<Document>& parts) -> Result<void> {
+    if (parts.size() < 2u) {
+        return {};
+    }
+
+    std::unordered_map<std::string_view, std::size_t> owners;
+    for (std::size_t index = 0u; index < parts.size(); ++index) {
+        auto root = parts[index].root();
+        if (!root) {
+            return makeUnexpected<void>(root.error());
+        }
+        const auto count = root->size();
+        for (std::size_t i = 0u; i < count; ++i) {
+            auto key = root->keyAt(i);
+            if (!key) {
+                return makeUnexpected<void>(key.error());
+            }
+            if (!owners.try_emplace(*key, index).second) {
+                auto error = Error{ErrorCode::DuplicateKey, "Top-level key is defined in more than one part."};
+                error.index = index;
+                return makeUnexpected<void>(error);
+            }
+        }
+    }
+    return {};
+}
+
+} // namespace
+
+auto LargeDocument::isValid() const noexcept -> bool {
+    return !parts_.empty() && std::ranges::all_of(parts_, [](const Document& part) { return part.isValid(); });
+}
+
+auto LargeDocument::partCount() const noexcept -> std::size_t {
+    return parts_.size();
+}
+
+auto LargeDocument::part(std::size_t index) const -> const Document& {
+    return parts_.at(index);
+}
+
+auto LargeDocument::partOffset(std::size_t index) const -> std::uint64_t {
+    return offsets_.at(index);
+}
+
+auto LargeDocument::root() const -> Result<MergedView> {
+    if (!isValid()) {
+        return makeUnexpected<MergedView>(Error{ErrorCode::InvalidState, "Large document has no parsed parts."});
+    }
+    return view_;
+}
+
+auto LargeDocument::get(std::string_view dotPath) const -> Result<MergedView> {
+    if (!isValid()) {
+        return makeUnexpected<MergedView>(Error{ErrorCode::InvalidState, "Large document has no parsed parts."});
+    }
+    return view_.get(dotPath);
+}
+
+auto LargeDocument::find(std::string_view dotPath) const -> MergedView {
+    if (!isValid()) {
+        return {};
+    }
+    return view_.find(dotPath);
+}
+
+auto parseLarge(std::string_view toml, ParseOptions options, std::size_t chunkBytes) -> Result<LargeDocument> {
+    constexpr std::size_t maxPartBytes = (std::numeric_limits<std::uint32_t>::max)();
+    chunkBytes = std::clamp<std::size_t>(chunkBytes, 1u, maxPartBytes);
+
+    std::vector<std::size_t> cuts;
+    if (toml.size() > chunkBytes) {
+        cuts = findCuts(toml, chunkBytes);
+    }
+    cuts.push_back(toml.size());
+
+    LargeDocument out;
+    out.parts_.reserve(cuts.size());
+    out.offsets_.reserve(cuts.size());
+
+    std::size_t begin = 0u;
+    std::uint64_t lineBase = 0u;
+    for (const auto end : cuts) {
+        const auto piece = toml.substr(begin, end - begin);
+        auto part = parse(piece, options);
+        if (!part) {
+            auto error = part.error();
+            error.byteOffset += begin;
+            if (error.line != 0u) {
+                error.line += lineBase;
+            }
+            error.index = out.parts_.size();
+            return makeUnexpected<LargeDocument>(error);
+        }
+
+        out.parts_.push_back(std::move(*part));
+        out.offsets_.push_back(begin);
+        lineBase += static_cast<std::uint64_t>(std::ranges::count(piece, '\n'));
+        begin = end;
+    }
+
+    auto disjoint = checkDisjointParts(out.parts_);
+    if (!disjoint) {
+        return makeUnexpected<LargeDocument>(disjoint.error());
+    }
+    for (const auto& part : out.parts_) {
+        auto status = out.view_.push(part);
+        if (!status) {
+            return makeUnexpected<LargeDocument>(status.error());
+        }
+    }
+    return out;
+}
+
+} // namespace Fastoml
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Document.hpp"
+#include "MergedView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Fastoml {
+
+inline constexpr std::size_t defaultLargeChunkBytes = std::size_t{1u} << 30u;
+
+class LargeDocument {
+public:
+    LargeDocument() = default;
+
+    [[nodiscard]] auto isValid() const noexcept -> bool;
+    [[nodiscard]] auto partCount() const noexcept -> std::size_t;
+    [[nodiscard]] auto part(std::size_t index) const -> const Document&;
+    [[nodiscard]] auto partOffset(std::size_t index) const -> std::uint64_t;
+
+    [[nodiscard]] auto root() const -> Result<MergedView>;
+    [[nodiscard]] auto get(std::string_view dotPath) const -> Result<MergedView>;
+    [[nodiscard]] auto find(std::string_view dotPath) const -> MergedView;
+
+private:
+    std::vector<Document> parts_;
+    std::vector<std::uint64_t> offsets_;
+    MergedView view_;
+
+    friend auto parseLarge(std::string_view toml, ParseOptions options, std::size_t chunkBytes)
+        -> Result<LargeDocument>;
+};
+
+[[nodiscard]] auto parseLarge(std::string_view toml, ParseOptions options = {},
+                              std::size_t chunkBytes = defaultLargeChunkBytes) -> Result<LargeDocument>;
+
+} // namespace Fastoml
@@ -0,0 +1,181 @@
+#include "MergedView.hpp"
+
+#include "detail/PathParser.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace Fastoml {
+
+namespace {
+
+auto materializeTable(const MergedView& view, NodeBuilder& output) -> Result<void> {
+    auto entries = view.entries();
+    if (!entries) {
+        return makeUnexpected<void>(entries.error());
+    }
+
+    for (const auto& entry : *entries) {
+        if (entry.value.kind() == NodeKind::Table && entry.value.layerCount() > 1u) {
+            auto table = output.table(entry.key);
+            if (!table) {
+                return makeUnexpected<void>(table.error());
+            }
+            auto status = materializeTable(entry.value, *table);
+            if (!status) {
+                return status;
+            }
+        } else {
+            auto status = output.set(entry.key, entry.value.node());
+            if (!status) {
+                return makeUnexpected<void>(status.error());
+            }
+        }
+    }
+    return {};
+}
+
+} // namespace
+
+auto MergedView::push(const Document& layer) -> Result<void> {
+    auto rootNode = layer.root();
+    if (!rootNode) {
+        return makeUnexpected<void>(rootNode.error());
+    }
+    push(*rootNode);
+    return {};
+}
+
+auto MergedView::push(const NodeView& layer) -> void {
+    if (!layer.valid()) {
+        return;
+    }
+    if (layer.kind() != NodeKind::Table) {
+        layers_.clear();
+    }
+    layers_.push_back(layer);
+}
+
+auto MergedView::valid() const noexcept -> bool {
+    return !layers_.empty();
+}
+
+auto MergedView::kind() const -> NodeKind {
+    return node().kind();
+}
+
+auto MergedView::node() const noexcept -> NodeView {
+    return layers_.empty() ? NodeView() : layers_.back();
+}
+
+auto MergedView::layerCount() const noexcept -> std::size_t {
+    return layers_.size();
+}
+
+auto MergedView::child(std::string_view key) const -> MergedView {
+    MergedView out;
+    if (kind() != NodeKind::Table) {
+        return out;
+    }
+
+    for (auto layer = layers_.rbegin(); layer != layers_.rend(); ++layer) {
+        const auto value = layer->find(key);
+        if (!value.valid()) {
+            continue;
+        }
+        if (value.kind() != NodeKind::Table) {
+            if (out.layers_.empty()) {
+                out.layers_.push_back(value);
+            }
+            break;
+        }
+        out.layers_.push_back(value);
+    }
+
+    std::reverse(out.layers_.begin(), out.layers_.end());
+    return out;
+}
+
+auto MergedView::get(std::string_view dotPath) const -> Result<MergedView> {
+    if (!valid()) {
+        return makeUnexpected<MergedView>(Error{ErrorCode::InvalidState, "Merged view has no layers."});
+    }
+    if (dotPath.empty()) {
+        return *this;
+    }
+
+    MergedView current = *this;
+    detail::DotPathCursor cursor(dotPath);
+    while (!cursor.done()) {
+        const auto segment = cursor.next();
+        if (segment.empty()) {
+            return makeUnexpected<MergedView>(Error{ErrorCode::InvalidPath, "Dot path contains an empty segment."});
+        }
+        if (current.kind() != NodeKind::Table) {
+            return makeUnexpected<MergedView>(
+                keyError(ErrorCode::Type, "Path traversal requires table nodes for each segment.", dotPath, segment));
+        }
+
+        current = current.child(segment);
+        if (!current.valid()) {
+            return makeUnexpected<MergedView>(
+                keyError(ErrorCode::KeyNotFound, "Key not found in table", dotPath, segment));
+        }
+    }
+    return current;
+}
+
+auto MergedView::find(std::string_view dotPath) const -> MergedView {
+    if (!valid() || dotPath.empty()) {
+        return *this;
+    }
+
+    MergedView current = *this;
+    detail::DotPathCursor cursor(dotPath);
+    while (!cursor.done() && current.valid()) {
+        const auto segment = cursor.next();
+        if (segment.empty()) {
+            return {};
+        }
+        current = current.child(segment);
+    }
+    return current;
+}
+
+auto MergedView::entries() const -> Result<std::vector<MergedEntry>> {
+    if (kind() != NodeKind::Table) {
+        return makeUnexpected<std::vector<MergedEntry>>(Error{ErrorCode::Type, "Node is not a table."});
+    }
+
+    std::vector<MergedEntry> out;
+    for (std::size_t layer = 0u; layer < layers_.size(); ++layer) {
+        const auto count = layers_[layer].size();
+        for (std::size_t i = 0u; i < count; ++i) {
+            auto key = layers_[layer].keyAt(i);
+            if (!key) {
+                return makeUnexpected<std::vector<MergedEntry>>(key.error());
+            }
+
+            const auto seen = std::any_of(layers_.begin(), layers_.begin() + static_cast<std::ptrdiff_t>(layer),
+                                          [&](const NodeView& lower) { return lower.find(*key).valid(); });
+            if (!seen) {
+                out.push_back(MergedEntry{*key, child(*key)});
+            }
+        }
+    }
+    return out;
+}
+
+auto MergedView::materialize(Builder& output) const -> Result<void> {
+    if (kind() != NodeKind::Table) {
+        return makeUnexpected<void>(Error{ErrorCode::Type, "Only table views can be materialized."});
+    }
+
+    auto root = output.root();
+    if (!root.valid()) {
+        return makeUnexpected<void>(Error{ErrorCode::InvalidState, "Builder is not initialized."});
+    }
+    return materializeTable(*this, root);
+}
+
+} // namespace Fastoml
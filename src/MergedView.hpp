@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Builder.hpp"
+#include "Document.hpp"
+#include "NodeView.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Fastoml {
+
+struct MergedEntry;
+
+class MergedView {
+public:
+    MergedView() = default;
+
+    auto push(const Document& layer) -> Result<void>;
+    auto push(const NodeView& layer) -> void;
+
+    [[nodiscard]] auto valid() const noexcept -> bool;
+    [[nodiscard]] auto kind() const -> NodeKind;
+    [[nodiscard]] auto node() const noexcept -> NodeView;
+    [[nodiscard]] auto layerCount() const noexcept -> std::size_t;
+
+    [[nodiscard]] auto get(std::string_view dotPath) const -> Result<MergedView>;
+    [[nodiscard]] auto find(std::string_view dotPath) const -> MergedView;
+    [[nodiscard]] auto entries() const -> Result<std::vector<MergedEntry>>;
+    [[nodiscard]] auto materialize(Builder& output) const -> Result<void>;
+
+    template <typename T>
+    [[nodiscard]] auto as() const -> Result<T> {
+        return node().template as<T>();
+    }
+
+    template <typename T>
+    [[nodiscard]] auto tryAs() const -> std::optional<T> {
+        return node().template tryAs<T>();
+    }
+
+private:
+    std::vector<NodeView> layers_;
+
+    [[nodiscard]] auto child(std::string_view key) const -> MergedView;
+};
+
+struct MergedEntry {
+    std::string_view key;
+    MergedView value;
+};
+
+} // namespace Fastoml
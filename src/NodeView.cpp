@@ -1,9 +1,7 @@
 #include "NodeView.hpp"
 
 #include "detail/CInterop.hpp"
-
-#include <string>
-#include <utility>
+#include "detail/SourceMap.hpp"
 
 namespace {
 
@@ -39,6 +37,10 @@ namespace Fastoml {
 NodeView::NodeView(const fastoml_node* node) noexcept : node_(node) {
 }
 
+NodeView::NodeView(const fastoml_node* node, const detail::SourceMap* sourceMap) noexcept
+    : node_(node), sourceMap_(sourceMap) {
+}
+
 auto NodeView::valid() const noexcept -> bool {
     return node_ != nullptr;
 }
@@ -83,12 +85,89 @@ auto NodeView::get(std::string_view key) const -> Result<NodeView> {
 
     const auto* child = fastoml_table_get(node_, *keySlice);
     if (child == nullptr) {
-        auto message = std::string("Key not found in table: ");
-        message += key;
-        return makeUnexpected<NodeView>(Error{ErrorCode::KeyNotFound, std::move(message)});
+        return makeUnexpected<NodeView>(withLocation(keyError(ErrorCode::KeyNotFound, "Key not found in table", key)));
+    }
+
+    return NodeView(child, sourceMap_);
+}
+
+auto NodeView::find(std::string_view key) const noexcept -> NodeView {
+    if (node_ == nullptr || key.empty() || fastoml_node_kindof(node_) != FASTOML_NODE_TABLE) {
+        return {};
+    }
+
+    auto keySlice = detail::toSlice(key);
+    if (!keySlice) {
+        return {};
+    }
+    const auto* child = fastoml_table_get(node_, *keySlice);
+    return child != nullptr ? NodeView(child, sourceMap_) : NodeView();
+}
+
+auto NodeView::at(std::size_t index) const -> Result<NodeView> {
+    if (node_ == nullptr) {
+        return makeUnexpected<NodeView>(Error{ErrorCode::InvalidState, "Cannot read a null node."});
+    }
+
+    const auto nodeKind = fastoml_node_kindof(node_);
+    if (nodeKind != FASTOML_NODE_TABLE && nodeKind != FASTOML_NODE_ARRAY) {
+        return makeUnexpected<NodeView>(Error{ErrorCode::Type, "Node is not a table or array."});
+    }
+    if (index >= size()) {
+        return makeUnexpected<NodeView>(Error{ErrorCode::Overflow, "Child index is out of range."});
+    }
+
+    const auto rawIndex = static_cast<std::uint32_t>(index);
+    if (nodeKind == FASTOML_NODE_TABLE) {
+        return NodeView(fastoml_table_value_at(node_, rawIndex), sourceMap_);
+    }
+    return NodeView(fastoml_array_at(node_, rawIndex), sourceMap_);
+}
+
+auto NodeView::keyAt(std::size_t index) const -> Result<std::string_view> {
+    if (node_ == nullptr) {
+        return makeUnexpected<std::string_view>(Error{ErrorCode::InvalidState, "Cannot read a null node."});
+    }
+    if (fastoml_node_kindof(node_) != FASTOML_NODE_TABLE) {
+        return makeUnexpected<std::string_view>(Error{ErrorCode::Type, "Node is not a table."});
+    }
+    if (index >= size()) {
+        return makeUnexpected<std::string_view>(Error{ErrorCode::Overflow, "Child index is out of range."});
     }
 
-    return NodeView(child);
+    const auto key = fastoml_table_key_at(node_, static_cast<std::uint32_t>(index));
+    return std::string_view(key.ptr, key.len);
+}
+
+auto NodeView::location() const -> Result<SourceLocation> {
+    if (node_ == nullptr) {
+        return makeUnexpected<SourceLocation>(Error{ErrorCode::InvalidState, "Cannot read a null node."});
+    }
+    if (sourceMap_ == nullptr) {
+        return makeUnexpected<SourceLocation>(
+            Error{ErrorCode::InvalidState, "Node is not attached to a parsed document source."});
+    }
+
+    const auto location = sourceMap_->locate(detail::nodeSource(node_));
+    if (!location) {
+        return makeUnexpected<SourceLocation>(
+            Error{ErrorCode::InvalidState, "fastoml did not report a source span for this node."});
+    }
+    return *location;
+}
+
+auto NodeView::withLocation(Error error) const -> Error {
+    if (sourceMap_ == nullptr || node_ == nullptr || error.line != 0u) {
+        return error;
+    }
+
+    const auto location = sourceMap_->locate(detail::nodeSource(node_));
+    if (location) {
+        error.byteOffset = location->byteOffset;
+        error.line = location->line;
+        error.column = location->column;
+    }
+    return error;
 }
 
 auto NodeView::asBool() const -> Result<bool> {
@@ -99,7 +178,7 @@ auto NodeView::asBool() const -> Result<bool> {
     int value = 0;
     const auto status = fastoml_node_as_bool(node_, &value);
     if (status != FASTOML_OK) {
-        return makeUnexpected<bool>(detail::toError(status, nullptr, "Failed to read bool value"));
+        return makeUnexpected<bool>(withLocation(detail::toError(status, nullptr, "Failed to read bool value")));
     }
     return value != 0;
 }
@@ -112,7 +191,7 @@ auto NodeView::asInt64() const -> Result<std::int64_t> {
     std::int64_t value = 0;
     const auto status = fastoml_node_as_int(node_, &value);
     if (status != FASTOML_OK) {
-        return makeUnexpected<std::int64_t>(detail::toError(status, nullptr, "Failed to read int value"));
+        return makeUnexpected<std::int64_t>(withLocation(detail::toError(status, nullptr, "Failed to read int value")));
     }
     return value;
 }
@@ -125,7 +204,7 @@ auto NodeView::asDouble() const -> Result<double> {
     double value = 0.0;
     const auto status = fastoml_node_as_float(node_, &value);
     if (status != FASTOML_OK) {
-        return makeUnexpected<double>(detail::toError(status, nullptr, "Failed to read float value"));
+        return makeUnexpected<double>(withLocation(detail::toError(status, nullptr, "Failed to read float value")));
     }
     return value;
 }
@@ -139,7 +218,7 @@ auto NodeView::asStringView() const -> Result<std::string_view> {
     const auto status = fastoml_node_as_slice(node_, &slice);
     if (status != FASTOML_OK) {
         return makeUnexpected<std::string_view>(
-            detail::toError(status, nullptr, "Failed to read string-like value"));
+            withLocation(detail::toError(status, nullptr, "Failed to read string-like value")));
     }
     return std::string_view(slice.ptr, slice.len);
 }
@@ -148,4 +227,43 @@ auto NodeView::raw() const noexcept -> const fastoml_node* {
     return node_;
 }
 
+auto NodeView::elementAt(std::size_t index) const noexcept -> NodeView {
+    return NodeView(fastoml_array_at(node_, static_cast<std::uint32_t>(index)), sourceMap_);
+}
+
+auto NodeView::elementError(ErrorCode code, std::size_t index) noexcept -> Error {
+    Error out;
+    out.code = code;
+    out.summary = code == ErrorCode::Overflow ? "Array element does not fit the output type"
+                                              : "Array element has an unexpected type";
+    out.index = index;
+    return out;
+}
+
+auto NodeView::readBool(bool& out) const noexcept -> bool {
+    int value = 0;
+    if (node_ == nullptr || fastoml_node_as_bool(node_, &value) != FASTOML_OK) {
+        return false;
+    }
+    out = value != 0;
+    return true;
+}
+
+auto NodeView::readInt64(std::int64_t& out) const noexcept -> bool {
+    return node_ != nullptr && fastoml_node_as_int(node_, &out) == FASTOML_OK;
+}
+
+auto NodeView::readDouble(double& out) const noexcept -> bool {
+    return node_ != nullptr && fastoml_node_as_float(node_, &out) == FASTOML_OK;
+}
+
+auto NodeView::readStringView(std::string_view& out) const noexcept -> bool {
+    fastoml_slice slice;
+    if (node_ == nullptr || fastoml_node_as_slice(node_, &slice) != FASTOML_OK) {
+        return false;
+    }
+    out = std::string_view(slice.ptr, slice.len);
+    return true;
+}
+
 } // namespace Fastoml
@@ -5,14 +5,30 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 
 struct fastoml_node;
 
 namespace Fastoml {
 
+namespace detail {
+
+class SourceMap;
+
+} // namespace detail
+
+struct SourceLocation {
+    std::uint64_t byteOffset = 0u;
+    std::uint64_t length = 0u;
+    std::uint64_t line = 0u;
+    std::uint64_t column = 0u;
+};
+
 enum class NodeKind {
     Table = 1,
     Array = 2,
@@ -30,11 +46,16 @@ class NodeView {
 public:
     NodeView() = default;
     explicit NodeView(const fastoml_node* node) noexcept;
+    NodeView(const fastoml_node* node, const detail::SourceMap* sourceMap) noexcept;
 
     [[nodiscard]] auto valid() const noexcept -> bool;
     [[nodiscard]] auto kind() const -> NodeKind;
     [[nodiscard]] auto size() const -> std::size_t;
     [[nodiscard]] auto get(std::string_view key) const -> Result<NodeView>;
+    [[nodiscard]] auto find(std::string_view key) const noexcept -> NodeView;
+    [[nodiscard]] auto at(std::size_t index) const -> Result<NodeView>;
+    [[nodiscard]] auto keyAt(std::size_t index) const -> Result<std::string_view>;
+    [[nodiscard]] auto location() const -> Result<SourceLocation>;
 
     [[nodiscard]] auto asBool() const -> Result<bool>;
     [[nodiscard]] auto asInt64() const -> Result<std::int64_t>;
@@ -58,22 +79,9 @@ public:
             }
 
             const auto raw = *value;
-            if constexpr (std::is_signed_v<T>) {
-                if (raw < static_cast<std::int64_t>((std::numeric_limits<T>::lowest)()) ||
-                    raw > static_cast<std::int64_t>((std::numeric_limits<T>::max)())) {
-                    return makeUnexpected<T>(
-                        Error{ErrorCode::Overflow, "Integer conversion overflow while reading node."});
-                }
-            } else {
-                if (raw < 0) {
-                    return makeUnexpected<T>(
-                        Error{ErrorCode::Overflow, "Integer conversion overflow while reading node."});
-                }
-                if (static_cast<std::uint64_t>(raw) >
-                    static_cast<std::uint64_t>((std::numeric_limits<T>::max)())) {
-                    return makeUnexpected<T>(
-                        Error{ErrorCode::Overflow, "Integer conversion overflow while reading node."});
-                }
+            if (!integerFits<T>(raw)) {
+                return makeUnexpected<T>(
+                    withLocation(Error{ErrorCode::Overflow, "Integer conversion overflow while reading node."}));
             }
             return static_cast<T>(raw);
         }
@@ -102,10 +110,116 @@ public:
             Error{ErrorCode::UnsupportedType, "Requested type is not supported by NodeView::as()."});
     }
 
+    template <typename T>
+    [[nodiscard]] auto tryAs() const -> std::optional<T> {
+        if constexpr (std::is_same_v<T, bool>) {
+            bool value = false;
+            return readBool(value) ? std::optional<T>(value) : std::nullopt;
+        } else if constexpr (std::is_integral_v<T>) {
+            std::int64_t value = 0;
+            if (!readInt64(value) || !integerFits<T>(value)) {
+                return std::nullopt;
+            }
+            return static_cast<T>(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            double value = 0.0;
+            return readDouble(value) ? std::optional<T>(static_cast<T>(value)) : std::nullopt;
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            std::string_view value;
+            return readStringView(value) ? std::optional<T>(value) : std::nullopt;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            std::string_view value;
+            return readStringView(value) ? std::optional<T>(std::string(value)) : std::nullopt;
+        } else {
+            static_assert(sizeof(T) == 0u, "Requested type is not supported by NodeView::tryAs().");
+        }
+    }
+
+    template <typename T>
+    [[nodiscard]] auto valueOr(T fallback) const -> T {
+        auto value = tryAs<T>();
+        return value ? std::move(*value) : std::move(fallback);
+    }
+
+    template <typename T>
+    [[nodiscard]] auto copyTo(std::span<T> output) const -> Result<std::size_t>
+        requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    {
+        if (kind() != NodeKind::Array) {
+            return makeUnexpected<std::size_t>(Error{ErrorCode::Type, "Node is not an array."});
+        }
+
+        const auto count = size();
+        if (output.size() < count) {
+            return makeUnexpected<std::size_t>(Error{ErrorCode::Overflow, "Output span is smaller than the array."});
+        }
+
+        for (std::size_t i = 0u; i < count; ++i) {
+            const auto element = elementAt(i);
+            if constexpr (std::is_integral_v<T>) {
+                std::int64_t value = 0;
+                if (!element.readInt64(value)) {
+                    return makeUnexpected<std::size_t>(element.withLocation(elementError(ErrorCode::Type, i)));
+                }
+                if (!integerFits<T>(value)) {
+                    return makeUnexpected<std::size_t>(element.withLocation(elementError(ErrorCode::Overflow, i)));
+                }
+                output[i] = static_cast<T>(value);
+            } else {
+                double value = 0.0;
+                std::int64_t integer = 0;
+                if (element.readDouble(value)) {
+                    if (!floatFits<T>(value)) {
+                        return makeUnexpected<std::size_t>(element.withLocation(elementError(ErrorCode::Overflow, i)));
+                    }
+                    output[i] = static_cast<T>(value);
+                } else if (element.readInt64(integer)) {
+                    output[i] = static_cast<T>(integer);
+                } else {
+                    return makeUnexpected<std::size_t>(element.withLocation(elementError(ErrorCode::Type, i)));
+                }
+            }
+        }
+        return count;
+    }
+
     [[nodiscard]] auto raw() const noexcept -> const fastoml_node*;
 
 private:
     const fastoml_node* node_ = nullptr;
+    const detail::SourceMap* sourceMap_ = nullptr;
+
+    template <typename T>
+    [[nodiscard]] static constexpr auto integerFits(std::int64_t raw) noexcept -> bool {
+        if constexpr (std::is_signed_v<T>) {
+            return raw >= static_cast<std::int64_t>((std::numeric_limits<T>::lowest)()) &&
+                   raw <= static_cast<std::int64_t>((std::numeric_limits<T>::max)());
+        } else {
+            return raw >= 0 &&
+                   static_cast<std::uint64_t>(raw) <= static_cast<std::uint64_t>((std::numeric_limits<T>::max)());
+        }
+    }
+
+    // Finite values beyond T's range make the narrowing cast undefined; inf and nan convert exactly.
+    template <typename T>
+    [[nodiscard]] static constexpr auto floatFits(double raw) noexcept -> bool {
+        if constexpr (sizeof(T) >= sizeof(double)) {
+            return true;
+        } else {
+            constexpr auto limit = static_cast<double>((std::numeric_limits<T>::max)());
+            constexpr auto infinity = std::numeric_limits<double>::infinity();
+            return raw != raw || raw == infinity || raw == -infinity || (raw >= -limit && raw <= limit);
+        }
+    }
+
+    [[nodiscard]] auto elementAt(std::size_t index) const noexcept -> NodeView;
+    [[nodiscard]] static auto elementError(ErrorCode code, std::size_t index) noexcept -> Error;
+    [[nodiscard]] auto withLocation(Error error) const -> Error;
+
+    [[nodiscard]] auto readBool(bool& out) const noexcept -> bool;
+    [[nodiscard]] auto readInt64(std::int64_t& out) const noexcept -> bool;
+    [[nodiscard]] auto readDouble(double& out) const noexcept -> bool;
+    [[nodiscard]] auto readStringView(std::string_view& out) const noexcept -> bool;
 };
 
 } // namespace Fastoml
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory_resource>
 
 namespace Fastoml {
 
@@ -9,14 +10,22 @@ struct ParseOptions {
     bool disableSimd = false;
     bool trustUtf8 = false;
     std::uint32_t maxDepth = 256u;
+    std::pmr::memory_resource* memoryResource = nullptr;
 };
 
 struct BuilderOptions {
     std::uint32_t maxDepth = 256u;
+    std::pmr::memory_resource* memoryResource = nullptr;
 };
 
 struct SerializeOptions {
     bool finalNewline = true;
 };
 
+struct WriterOptions {
+    // Keep the value keys of closed tables so a later header through one of them (`[a] x = 1` then `[a.x]`) is
+    // rejected. Off by default: memory then grows with the number of headers instead of the number of keys.
+    bool retainClosedKeys = false;
+};
+
 } // namespace Fastoml
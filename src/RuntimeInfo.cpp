@@ -0,0 +1,61 @@
+#include "RuntimeInfo.hpp"
+
+#include "Instrumentation.hpp"
+
+namespace Fastoml {
+
+namespace {
+
+auto hostSimdPath() noexcept -> SimdPath {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        return SimdPath::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdPath::Avx2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return SimdPath::Sse42;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdPath::Sse2;
+    }
+    return SimdPath::Scalar;
+#elif defined(_M_X64)
+    return SimdPath::Sse2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    return SimdPath::Neon;
+#else
+    return SimdPath::Scalar;
+#endif
+}
+
+} // namespace
+
+auto simdPathName(SimdPath path) noexcept -> std::string_view {
+    switch (path) {
+    case SimdPath::Sse2:
+        return "sse2";
+    case SimdPath::Sse42:
+        return "sse4.2";
+    case SimdPath::Avx2:
+        return "avx2";
+    case SimdPath::Avx512:
+        return "avx512";
+    case SimdPath::Neon:
+        return "neon";
+    default:
+        return "scalar";
+    }
+}
+
+auto runtimeInfo(const ParseOptions& options) noexcept -> RuntimeInfo {
+    RuntimeInfo info;
+    info.hostPath = hostSimdPath();
+    info.simdDisabled = options.disableSimd;
+    info.instrumentation = instrumentationEnabled();
+    return info;
+}
+
+} // namespace Fastoml
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Options.hpp"
+
+#include <string_view>
+
+namespace Fastoml {
+
+enum class SimdPath {
+    Scalar = 0,
+    Sse2,
+    Sse42,
+    Avx2,
+    Avx512,
+    Neon,
+};
+
+struct RuntimeInfo {
+    SimdPath hostPath = SimdPath::Scalar;
+    bool simdDisabled = false;
+    bool instrumentation = false;
+};
+
+[[nodiscard]] auto simdPathName(SimdPath path) noexcept -> std::string_view;
+
+// hostPath is the best ISA the CPU supports. fastoml does not report which kernel it dispatches to, so the path it
+// actually selects is unknown; simdDisabled only says that `options.disableSimd` forces the scalar kernel.
+[[nodiscard]] auto runtimeInfo(const ParseOptions& options = {}) noexcept -> RuntimeInfo;
+
+} // namespace Fastoml
@@ -0,0 +1,57 @@
+#include "detail/SourceMap.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Fastoml::detail {
+
+auto SourceMap::setSource(std::string_view source) noexcept -> void {
+    source_ = source;
+    lineStarts_.clear();
+    indexed_.store(false, std::memory_order_release);
+}
+
+auto SourceMap::buildIndex() const -> void {
+    lineStarts_.push_back(0u);
+
+    const auto* begin = source_.data();
+    const auto* end = begin + source_.size();
+    const auto* cursor = begin;
+    while (cursor < end) {
+        const auto remaining = static_cast<std::size_t>(end - cursor);
+        const auto* newline = static_cast<const char*>(std::memchr(cursor, '\n', remaining));
+        if (newline == nullptr) {
+            break;
+        }
+        lineStarts_.push_back(static_cast<std::uint32_t>(newline + 1 - begin));
+        cursor = newline + 1;
+    }
+}
+
+auto SourceMap::locate(std::string_view span) const -> std::optional<SourceLocation> {
+    const auto* begin = source_.data();
+    if (span.data() == nullptr || begin == nullptr || span.data() < begin ||
+        span.data() + span.size() > begin + source_.size()) {
+        return std::nullopt;
+    }
+
+    if (!indexed_.load(std::memory_order_acquire)) {
+        std::lock_guard lock(indexMutex_);
+        if (!indexed_.load(std::memory_order_relaxed)) {
+            buildIndex();
+            indexed_.store(true, std::memory_order_release);
+        }
+    }
+
+    const auto offset = static_cast<std::uint32_t>(span.data() - begin);
+    const auto lineStart = std::upper_bound(lineStarts_.begin(), lineStarts_.end(), offset) - 1;
+
+    SourceLocation out;
+    out.byteOffset = offset;
+    out.length = static_cast<std::uint32_t>(span.size());
+    out.line = static_cast<std::uint64_t>(lineStart - lineStarts_.begin()) + 1u;
+    out.column = offset - *lineStart + 1u;
+    return out;
+}
+
+} // namespace Fastoml::detail
@@ -0,0 +1,98 @@
+#include "StringPool.hpp"
+
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace Fastoml {
+
+namespace {
+
+constexpr std::size_t chunkSize = 64u * 1024u;
+
+struct ViewHash {
+    using is_transparent = void;
+
+    auto operator()(std::string_view text) const noexcept -> std::size_t {
+        return std::hash<std::string_view>{}(text);
+    }
+};
+
+} // namespace
+
+struct StringPool::Impl {
+    mutable std::shared_mutex mutex;
+    std::unordered_set<std::string_view, ViewHash, std::equal_to<>> entries;
+    std::vector<std::unique_ptr<char[]>> chunks;
+    std::vector<std::unique_ptr<char[]>> largeStrings;
+    std::size_t chunkUsed = chunkSize;
+    std::size_t bytes = 0u;
+
+    auto store(std::string_view text) -> std::string_view {
+        char* data = nullptr;
+        if (text.size() > chunkSize / 4u) {
+            largeStrings.push_back(std::make_unique_for_overwrite<char[]>(text.size()));
+            data = largeStrings.back().get();
+        } else {
+            if (chunkUsed + text.size() > chunkSize) {
+                chunks.push_back(std::make_unique_for_overwrite<char[]>(chunkSize));
+                chunkUsed = 0u;
+            }
+            data = chunks.back().get() + chunkUsed;
+            chunkUsed += text.size();
+        }
+
+        std::memcpy(data, text.data(), text.size());
+        bytes += text.size();
+        return std::string_view(data, text.size());
+    }
+};
+
+StringPool::StringPool() : impl_(std::make_unique<Impl>()) {
+}
+
+StringPool::~StringPool() = default;
+
+auto StringPool::intern(std::string_view text) -> std::string_view {
+    if (text.empty()) {
+        return {};
+    }
+
+    {
+        std::shared_lock lock(impl_->mutex);
+        const auto found = impl_->entries.find(text);
+        if (found != impl_->entries.end()) {
+            return *found;
+        }
+    }
+
+    std::unique_lock lock(impl_->mutex);
+    const auto found = impl_->entries.find(text);
+    if (found != impl_->entries.end()) {
+        return *found;
+    }
+
+    const auto stored = impl_->store(text);
+    impl_->entries.insert(stored);
+    return stored;
+}
+
+auto StringPool::contains(std::string_view text) const -> bool {
+    std::shared_lock lock(impl_->mutex);
+    return impl_->entries.contains(text);
+}
+
+auto StringPool::size() const -> std::size_t {
+    std::shared_lock lock(impl_->mutex);
+    return impl_->entries.size();
+}
+
+auto StringPool::bytes() const -> std::size_t {
+    std::shared_lock lock(impl_->mutex);
+    return impl_->bytes;
+}
+
+} // namespace Fastoml
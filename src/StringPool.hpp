@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace Fastoml {
+
+class StringPool {
+public:
+    StringPool();
+    ~StringPool();
+
+    StringPool(const StringPool&) = delete;
+    auto operator=(const StringPool&) -> StringPool& = delete;
+
+    [[nodiscard]] auto intern(std::string_view text) -> std::string_view;
+    [[nodiscard]] auto contains(std::string_view text) const -> bool;
+    [[nodiscard]] auto size() const -> std::size_t;
+    [[nodiscard]] auto bytes() const -> std::size_t;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace Fastoml
@@ -2,14 +2,22 @@
 
 #include "Builder.hpp"
 #include "Document.hpp"
+#include "EnumModel.hpp"
+#include "Instrumentation.hpp"
 #include "PathRef.hpp"
+#include "StringPool.hpp"
 
+#include <bitset>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <variant>
+#include <vector>
 
 namespace Fastoml {
 
@@ -36,25 +44,105 @@ template <FixedString Key, typename Owner, typename Member>
     return StaticFieldRef<Owner, Member, Key>{member};
 }
 
+enum class SchemaMode {
+    Owned,
+    Borrowed,
+    Pooled,
+};
+
+struct SchemaViolation {
+    ErrorCode code = ErrorCode::Ok;
+    const char* summary = "";
+    std::string path;
+    NodeKind expected = NodeKind::Unknown;
+    NodeKind actual = NodeKind::Unknown;
+    std::uint64_t line = 0u;
+    std::uint64_t column = 0u;
+};
+
+template <typename T>
+class FieldChanges {
+public:
+    static constexpr std::size_t fieldCount = std::tuple_size_v<decltype(Model<T>::fields())>;
+
+    [[nodiscard]] auto any() const noexcept -> bool {
+        return bits_.any();
+    }
+
+    [[nodiscard]] auto count() const noexcept -> std::size_t {
+        return bits_.count();
+    }
+
+    [[nodiscard]] auto changed(std::size_t index) const noexcept -> bool {
+        return index < fieldCount && bits_.test(index);
+    }
+
+    [[nodiscard]] auto changed(std::string_view key) const noexcept -> bool {
+        return changedKey(key, std::make_index_sequence<fieldCount>{});
+    }
+
+    template <typename FieldRef>
+    [[nodiscard]] auto changed(const FieldRef&) const noexcept -> bool
+        requires requires { FieldRef::key(); }
+    {
+        return changed(FieldRef::key());
+    }
+
+    auto mark(std::size_t index) noexcept -> void {
+        bits_.set(index);
+    }
+
+private:
+    std::bitset<fieldCount> bits_;
+
+    template <std::size_t... Indices>
+    [[nodiscard]] auto changedKey(std::string_view key, std::index_sequence<Indices...>) const noexcept -> bool {
+        using Tuple = decltype(Model<T>::fields());
+        return ((std::tuple_element_t<Indices, Tuple>::key() == key && bits_.test(Indices)) || ...);
+    }
+};
+
 namespace detail {
 
 template <typename T>
 using Decayed = std::remove_cv_t<std::remove_reference_t<T>>;
 
 template <typename T>
-[[nodiscard]] auto decodeNode(const NodeView& node) -> Result<T>;
+struct IsOptional : std::false_type {};
 
-template <typename T, typename FieldRef>
-[[nodiscard]] auto decodeField(const NodeView& tableNode, T& output, const FieldRef& ref) -> Result<void> {
+template <typename T>
+struct IsOptional<std::optional<T>> : std::true_type {};
+
+enum class DecodeMode {
+    Owned,
+    Borrowed,
+};
+
+template <typename T, DecodeMode Mode = DecodeMode::Owned>
+[[nodiscard]] auto decodeNode(const NodeView& node, StringPool* pool = nullptr) -> Result<T>;
+
+template <DecodeMode Mode, typename T, typename FieldRef>
+[[nodiscard]] auto decodeField(const NodeView& tableNode, T& output, const FieldRef& ref, StringPool* pool)
+    -> Result<void> {
     using Owner = typename FieldRef::OwnerType;
     using Member = typename FieldRef::MemberType;
     using MemberDecayed = Decayed<Member>;
 
     static_assert(std::is_same_v<Owner, T>, "Field owner type must match model type.");
 
-    if constexpr (std::is_same_v<MemberDecayed, std::string_view>) {
-        return makeUnexpected<void>(
-            Error{ErrorCode::UnsupportedType, "std::string_view is not supported for decode output fields."});
+    if constexpr (IsOptional<MemberDecayed>::value) {
+        const auto node = tableNode.find(FieldRef::key());
+        if (!node.valid()) {
+            output.*(ref.member) = std::nullopt;
+            return {};
+        }
+
+        auto value = decodeNode<typename MemberDecayed::value_type, Mode>(node, pool);
+        if (!value) {
+            return makeUnexpected<void>(value.error());
+        }
+        output.*(ref.member) = std::move(*value);
+        return {};
     }
 
     auto node = tableNode.get(FieldRef::key());
@@ -62,7 +150,7 @@ template <typename T, typename FieldRef>
         return makeUnexpected<void>(node.error());
     }
 
-    auto value = decodeNode<MemberDecayed>(*node);
+    auto value = decodeNode<MemberDecayed, Mode>(*node, pool);
     if (!value) {
         return makeUnexpected<void>(value.error());
     }
@@ -71,44 +159,253 @@ template <typename T, typename FieldRef>
     return {};
 }
 
-template <std::size_t Index, typename T, typename Tuple>
-[[nodiscard]] auto decodeFields(const NodeView& tableNode, T& output, const Tuple& refs) -> Result<void> {
+template <DecodeMode Mode, std::size_t Index, typename T, typename Tuple>
+[[nodiscard]] auto decodeFields(const NodeView& tableNode, T& output, const Tuple& refs, StringPool* pool)
+    -> Result<void> {
     if constexpr (Index >= std::tuple_size_v<Tuple>) {
         return {};
     } else {
-        auto status = decodeField(tableNode, output, std::get<Index>(refs));
+        auto status = decodeField<Mode>(tableNode, output, std::get<Index>(refs), pool);
         if (!status) {
             return makeUnexpected<void>(status.error());
         }
-        return decodeFields<Index + 1u>(tableNode, output, refs);
+        return decodeFields<Mode, Index + 1u>(tableNode, output, refs, pool);
     }
 }
 
-template <typename T>
-[[nodiscard]] auto decodeObject(const NodeView& node) -> Result<T> {
+template <typename T, DecodeMode Mode = DecodeMode::Owned>
+[[nodiscard]] auto decodeObject(const NodeView& node, StringPool* pool = nullptr) -> Result<T> {
     if (node.kind() != NodeKind::Table) {
         return makeUnexpected<T>(Error{ErrorCode::Type, "Decoded node must be a TOML table."});
     }
 
     T output{};
     const auto refs = Model<T>::fields();
-    auto status = decodeFields<0u>(node, output, refs);
+    auto status = decodeFields<Mode, 0u>(node, output, refs, pool);
     if (!status) {
         return makeUnexpected<T>(status.error());
     }
     return output;
 }
 
+template <typename E>
+[[nodiscard]] auto decodeEnum(const NodeView& node) -> Result<E> {
+    auto name = node.asStringView();
+    if (!name) {
+        return makeUnexpected<E>(name.error());
+    }
+
+    const auto value = enumFromName<E>(*name);
+    if (!value) {
+        return makeUnexpected<E>(Error{ErrorCode::Type, "Unknown enumerator name"});
+    }
+    return *value;
+}
+
+template <typename V, std::size_t... Indices>
+[[nodiscard]] consteval auto alternativesAreModels(std::index_sequence<Indices...>) -> bool {
+    return (ModelDefined<std::variant_alternative_t<Indices, V>> && ...);
+}
+
+template <typename V, std::size_t... Indices>
+[[nodiscard]] consteval auto alternativesAreComparable(std::index_sequence<Indices...>) -> bool {
+    return (std::equality_comparable<std::variant_alternative_t<Indices, V>> && ...);
+}
+
+// std::variant declares operator== even when an alternative has none, so the concept alone is not enough.
 template <typename T>
-[[nodiscard]] auto decodeNode(const NodeView& node) -> Result<T> {
+[[nodiscard]] consteval auto decodedComparable() -> bool {
+    if constexpr (VariantModelDefined<T>) {
+        return alternativesAreComparable<T>(std::make_index_sequence<std::variant_size_v<T>>{});
+    } else {
+        return std::equality_comparable<T>;
+    }
+}
+
+template <typename V, std::size_t Index>
+[[nodiscard]] auto toVariant(Result<std::variant_alternative_t<Index, V>> value) -> Result<V> {
+    if (!value) {
+        return makeUnexpected<V>(value.error());
+    }
+    return V(std::in_place_index<Index>, std::move(*value));
+}
+
+template <typename V, DecodeMode Mode, std::size_t... Indices>
+[[nodiscard]] auto decodeAlternative(const NodeView& node, std::size_t index, StringPool* pool,
+                                     std::index_sequence<Indices...>) -> Result<V> {
+    Result<V> out = makeUnexpected<V>(Error{ErrorCode::InvalidState, "Variant alternative index is out of range."});
+    ((index == Indices ? (void)(out = toVariant<V, Indices>(
+                                    decodeNode<std::variant_alternative_t<Indices, V>, Mode>(node, pool)))
+                       : void()),
+     ...);
+    return out;
+}
+
+template <typename V, DecodeMode Mode>
+[[nodiscard]] auto decodeVariant(const NodeView& node, StringPool* pool) -> Result<V> {
+    constexpr auto alternatives = std::variant_size_v<V>;
+    static_assert(alternativesAreModels<V>(std::make_index_sequence<alternatives>{}),
+                  "Variant alternatives must have a Model<T> specialization.");
+
+    if (node.kind() != NodeKind::Table) {
+        return makeUnexpected<V>(Error{ErrorCode::Type, "Decoded variant must be a TOML table."});
+    }
+
+    auto tag = node.get(VariantModel<V>::tagKey);
+    if (!tag) {
+        return makeUnexpected<V>(tag.error());
+    }
+    auto name = tag->asStringView();
+    if (!name) {
+        return makeUnexpected<V>(name.error());
+    }
+
+    const auto index = variantTagTable<V>.find(*name);
+    if (index == alternatives) {
+        return makeUnexpected<V>(Error{ErrorCode::Type, "Unknown variant tag"});
+    }
+    return decodeAlternative<V, Mode>(node, index, pool, std::make_index_sequence<alternatives>{});
+}
+
+template <typename T, DecodeMode Mode>
+[[nodiscard]] auto decodeNode(const NodeView& node, StringPool* pool) -> Result<T> {
     using Value = Decayed<T>;
     if constexpr (ModelDefined<Value>) {
-        return decodeObject<Value>(node);
+        return decodeObject<Value, Mode>(node, pool);
+    } else if constexpr (EnumModelDefined<Value>) {
+        return decodeEnum<Value>(node);
+    } else if constexpr (VariantModelDefined<Value>) {
+        return decodeVariant<Value, Mode>(node, pool);
+    } else if constexpr (std::is_same_v<Value, std::string_view> && Mode == DecodeMode::Owned) {
+        if (pool == nullptr) {
+            return makeUnexpected<T>(Error{ErrorCode::UnsupportedType,
+                                           "std::string_view fields require decodeBorrowed or a StringPool."});
+        }
+
+        auto value = node.asStringView();
+        if (!value) {
+            return makeUnexpected<T>(value.error());
+        }
+        return pool->intern(*value);
     } else {
         return node.template as<Value>();
     }
 }
 
+template <typename T>
+[[nodiscard]] auto decodeObjectInto(const NodeView& node, T& target, FieldChanges<T>& changes) -> Result<void>;
+
+template <typename T>
+[[nodiscard]] auto assignNode(const NodeView& node, T& target) -> Result<bool> {
+    using Value = Decayed<T>;
+    if constexpr (ModelDefined<Value>) {
+        FieldChanges<Value> changes;
+        auto status = decodeObjectInto(node, target, changes);
+        if (!status) {
+            return makeUnexpected<bool>(status.error());
+        }
+        return changes.any();
+    } else if constexpr (std::is_same_v<Value, std::string_view>) {
+        return makeUnexpected<bool>(
+            Error{ErrorCode::UnsupportedType, "std::string_view is not supported for decode output fields."});
+    } else if constexpr (std::is_same_v<Value, std::string>) {
+        auto value = node.as<std::string_view>();
+        if (!value) {
+            return makeUnexpected<bool>(value.error());
+        }
+        if (target == *value) {
+            return false;
+        }
+        target.assign(*value);
+        return true;
+    } else if constexpr (EnumModelDefined<Value> || VariantModelDefined<Value>) {
+        auto value = decodeNode<Value>(node);
+        if (!value) {
+            return makeUnexpected<bool>(value.error());
+        }
+        if constexpr (decodedComparable<Value>()) {
+            if (target == *value) {
+                return false;
+            }
+        }
+        target = std::move(*value);
+        return true;
+    } else {
+        auto value = node.template as<Value>();
+        if (!value) {
+            return makeUnexpected<bool>(value.error());
+        }
+        if (target == *value) {
+            return false;
+        }
+        target = std::move(*value);
+        return true;
+    }
+}
+
+template <typename T, typename FieldRef>
+[[nodiscard]] auto decodeFieldInto(const NodeView& tableNode, T& target, const FieldRef& ref) -> Result<bool> {
+    using Owner = typename FieldRef::OwnerType;
+    using MemberDecayed = Decayed<typename FieldRef::MemberType>;
+
+    static_assert(std::is_same_v<Owner, T>, "Field owner type must match model type.");
+
+    auto& member = target.*(ref.member);
+    if constexpr (IsOptional<MemberDecayed>::value) {
+        const auto node = tableNode.find(FieldRef::key());
+        if (!node.valid()) {
+            if (!member.has_value()) {
+                return false;
+            }
+            member.reset();
+            return true;
+        }
+
+        const auto created = !member.has_value();
+        if (created) {
+            member.emplace();
+        }
+        auto changed = assignNode(node, *member);
+        if (!changed) {
+            return makeUnexpected<bool>(changed.error());
+        }
+        return created || *changed;
+    } else {
+        auto node = tableNode.get(FieldRef::key());
+        if (!node) {
+            return makeUnexpected<bool>(node.error());
+        }
+        return assignNode(*node, member);
+    }
+}
+
+template <std::size_t Index, typename T, typename Tuple>
+[[nodiscard]] auto decodeFieldsInto(const NodeView& tableNode, T& target, const Tuple& refs, FieldChanges<T>& changes)
+    -> Result<void> {
+    if constexpr (Index >= std::tuple_size_v<Tuple>) {
+        return {};
+    } else {
+        auto changed = decodeFieldInto(tableNode, target, std::get<Index>(refs));
+        if (!changed) {
+            return makeUnexpected<void>(changed.error());
+        }
+        if (*changed) {
+            changes.mark(Index);
+        }
+        return decodeFieldsInto<Index + 1u>(tableNode, target, refs, changes);
+    }
+}
+
+template <typename T>
+[[nodiscard]] auto decodeObjectInto(const NodeView& node, T& target, FieldChanges<T>& changes) -> Result<void> {
+    if (node.kind() != NodeKind::Table) {
+        return makeUnexpected<void>(Error{ErrorCode::Type, "Decoded node must be a TOML table."});
+    }
+
+    const auto refs = Model<T>::fields();
+    return decodeFieldsInto<0u>(node, target, refs, changes);
+}
+
 template <typename T>
 [[nodiscard]] auto setScalar(NodeBuilder& table, std::string_view key, const T& value) -> Result<void> {
     using Value = Decayed<T>;
@@ -123,6 +420,13 @@ template <typename T>
         setStatus = table.set(key, value);
     } else if constexpr (std::is_same_v<Value, bool>) {
         setStatus = table.set(key, value);
+    } else if constexpr (EnumModelDefined<Value>) {
+        const auto name = enumName(value);
+        if (name.empty()) {
+            return makeUnexpected<void>(
+                Error{ErrorCode::UnsupportedType, "Enum value has no name in its EnumModel."});
+        }
+        setStatus = table.set(key, name);
     } else if constexpr (std::is_floating_point_v<Value>) {
         setStatus = table.set(key, static_cast<double>(value));
     } else if constexpr (std::is_integral_v<Value>) {
@@ -138,6 +442,33 @@ template <typename T>
 template <typename T>
 [[nodiscard]] auto encodeNode(NodeBuilder& tableNode, const T& value) -> Result<void>;
 
+template <typename T>
+[[nodiscard]] auto encodeValue(NodeBuilder& tableNode, std::string_view key, const T& value) -> Result<void> {
+    using Value = Decayed<T>;
+    if constexpr (ModelDefined<Value>) {
+        auto nestedTable = tableNode.table(key);
+        if (!nestedTable) {
+            return makeUnexpected<void>(nestedTable.error());
+        }
+        auto nestedNode = *nestedTable;
+        return encodeNode(nestedNode, value);
+    } else if constexpr (VariantModelDefined<Value>) {
+        auto nestedTable = tableNode.table(key);
+        if (!nestedTable) {
+            return makeUnexpected<void>(nestedTable.error());
+        }
+        auto nestedNode = *nestedTable;
+        auto tagStatus = nestedNode.set(VariantModel<Value>::tagKey, VariantModel<Value>::tags()[value.index()]);
+        if (!tagStatus) {
+            return makeUnexpected<void>(tagStatus.error());
+        }
+        return std::visit([&nestedNode](const auto& alternative) { return encodeNode(nestedNode, alternative); },
+                          value);
+    } else {
+        return setScalar(tableNode, key, value);
+    }
+}
+
 template <typename T, typename FieldRef>
 [[nodiscard]] auto encodeField(NodeBuilder& tableNode, const T& source, const FieldRef& ref) -> Result<void> {
     using Owner = typename FieldRef::OwnerType;
@@ -147,15 +478,13 @@ template <typename T, typename FieldRef>
     static_assert(std::is_same_v<Owner, T>, "Field owner type must match model type.");
 
     const auto& memberValue = source.*(ref.member);
-    if constexpr (ModelDefined<MemberDecayed>) {
-        auto nestedTable = tableNode.table(FieldRef::key());
-        if (!nestedTable) {
-            return makeUnexpected<void>(nestedTable.error());
+    if constexpr (IsOptional<MemberDecayed>::value) {
+        if (!memberValue.has_value()) {
+            return {};
         }
-        auto nestedNode = *nestedTable;
-        return encodeNode(nestedNode, memberValue);
+        return encodeValue(tableNode, FieldRef::key(), *memberValue);
     } else {
-        return setScalar(tableNode, FieldRef::key(), memberValue);
+        return encodeValue(tableNode, FieldRef::key(), memberValue);
     }
 }
 
@@ -184,17 +513,289 @@ template <typename T>
     }
 }
 
+template <typename T>
+[[nodiscard]] consteval auto schemaKind() -> NodeKind {
+    using Value = Decayed<T>;
+    if constexpr (ModelDefined<Value> || VariantModelDefined<Value>) {
+        return NodeKind::Table;
+    } else if constexpr (EnumModelDefined<Value>) {
+        return NodeKind::String;
+    } else if constexpr (std::is_same_v<Value, bool>) {
+        return NodeKind::Bool;
+    } else if constexpr (std::is_integral_v<Value>) {
+        return NodeKind::Int;
+    } else if constexpr (std::is_floating_point_v<Value>) {
+        return NodeKind::Float;
+    } else if constexpr (std::is_same_v<Value, std::string> || std::is_same_v<Value, std::string_view>) {
+        return NodeKind::String;
+    } else {
+        return NodeKind::Unknown;
+    }
+}
+
+inline auto addViolation(std::vector<SchemaViolation>& violations, ErrorCode code, const char* summary,
+                         const std::string& path, NodeKind expected, NodeKind actual, const NodeView& at) -> void {
+    SchemaViolation violation;
+    violation.code = code;
+    violation.summary = summary;
+    violation.path = path;
+    violation.expected = expected;
+    violation.actual = actual;
+    if (auto location = at.location()) {
+        violation.line = location->line;
+        violation.column = location->column;
+    }
+    violations.push_back(std::move(violation));
+}
+
+template <typename T>
+auto checkNode(const NodeView& node, std::string& path, std::vector<SchemaViolation>& violations,
+               SchemaMode mode) -> void;
+
+template <typename T, typename FieldRef>
+auto checkField(const NodeView& tableNode, std::string& path, std::vector<SchemaViolation>& violations,
+                SchemaMode mode) -> void {
+    using Owner = typename FieldRef::OwnerType;
+    using MemberDecayed = Decayed<typename FieldRef::MemberType>;
+
+    static_assert(std::is_same_v<Owner, T>, "Field owner type must match model type.");
+
+    const auto previousSize = path.size();
+    if (!path.empty()) {
+        path += '.';
+    }
+    path += FieldRef::key();
+
+    const auto node = tableNode.find(FieldRef::key());
+    if constexpr (IsOptional<MemberDecayed>::value) {
+        if (node.valid()) {
+            checkNode<typename MemberDecayed::value_type>(node, path, violations, mode);
+        }
+    } else {
+        if (!node.valid()) {
+            addViolation(violations, ErrorCode::KeyNotFound, "Required key is missing", path,
+                         schemaKind<MemberDecayed>(), NodeKind::Unknown, tableNode);
+        } else {
+            checkNode<MemberDecayed>(node, path, violations, mode);
+        }
+    }
+
+    path.resize(previousSize);
+}
+
+template <typename V, std::size_t... Indices>
+auto checkAlternative(const NodeView& node, std::size_t index, std::string& path,
+                      std::vector<SchemaViolation>& violations, SchemaMode mode,
+                      std::index_sequence<Indices...>) -> void {
+    ((index == Indices
+          ? checkNode<std::variant_alternative_t<Indices, V>>(node, path, violations, mode)
+          : void()),
+     ...);
+}
+
+template <typename T, typename Tuple, std::size_t... Indices>
+auto checkFields(const NodeView& tableNode, std::string& path, std::vector<SchemaViolation>& violations,
+                 SchemaMode mode, std::index_sequence<Indices...>) -> void {
+    (checkField<T, std::tuple_element_t<Indices, Tuple>>(tableNode, path, violations, mode), ...);
+}
+
+template <typename T>
+auto checkNode(const NodeView& node, std::string& path, std::vector<SchemaViolation>& violations,
+               SchemaMode mode) -> void {
+    using Value = Decayed<T>;
+    if constexpr (ModelDefined<Value>) {
+        if (node.kind() != NodeKind::Table) {
+            addViolation(violations, ErrorCode::Type, "Expected a TOML table", path, NodeKind::Table, node.kind(),
+                         node);
+            return;
+        }
+
+        using Tuple = decltype(Model<Value>::fields());
+        checkFields<Value, Tuple>(node, path, violations, mode,
+                                  std::make_index_sequence<std::tuple_size_v<Tuple>>{});
+    } else if constexpr (EnumModelDefined<Value>) {
+        const auto name = node.template tryAs<std::string_view>();
+        if (!name) {
+            addViolation(violations, ErrorCode::Type, "Value has an unexpected type", path, NodeKind::String,
+                         node.kind(), node);
+        } else if (!enumFromName<Value>(*name)) {
+            addViolation(violations, ErrorCode::Type, "Unknown enumerator name", path, NodeKind::String,
+                         NodeKind::String, node);
+        }
+    } else if constexpr (VariantModelDefined<Value>) {
+        if (node.kind() != NodeKind::Table) {
+            addViolation(violations, ErrorCode::Type, "Expected a TOML table", path, NodeKind::Table, node.kind(),
+                         node);
+            return;
+        }
+
+        const auto tagNode = node.find(VariantModel<Value>::tagKey);
+        const auto tag = tagNode.template tryAs<std::string_view>();
+        if (!tag) {
+            addViolation(violations, tagNode.valid() ? ErrorCode::Type : ErrorCode::KeyNotFound,
+                         "Variant tag is missing or not a string", path, NodeKind::String, tagNode.kind(), node);
+            return;
+        }
+
+        const auto index = variantTagTable<Value>.find(*tag);
+        if (index == std::variant_size_v<Value>) {
+            addViolation(violations, ErrorCode::Type, "Unknown variant tag", path, NodeKind::String,
+                         NodeKind::String, tagNode);
+            return;
+        }
+        checkAlternative<Value>(node, index, path, violations, mode,
+                                std::make_index_sequence<std::variant_size_v<Value>>{});
+    } else if constexpr (std::is_same_v<Value, std::string_view>) {
+        if (mode == SchemaMode::Owned) {
+            addViolation(violations, ErrorCode::UnsupportedType,
+                         "std::string_view fields require decodeBorrowed or a StringPool", path,
+                         NodeKind::String, node.kind(), node);
+        } else if (!node.template tryAs<std::string_view>()) {
+            addViolation(violations, ErrorCode::Type, "Value has an unexpected type", path, NodeKind::String,
+                         node.kind(), node);
+        }
+    } else {
+        using Probe = std::conditional_t<std::is_same_v<Value, std::string>, std::string_view, Value>;
+        if (node.template tryAs<Probe>().has_value()) {
+            return;
+        }
+
+        constexpr auto expected = schemaKind<Value>();
+        if constexpr (std::is_integral_v<Value> && !std::is_same_v<Value, bool>) {
+            if (node.kind() == NodeKind::Int) {
+                addViolation(violations, ErrorCode::Overflow, "Integer value is out of range", path, expected,
+                             NodeKind::Int, node);
+                return;
+            }
+        }
+        addViolation(violations, ErrorCode::Type, "Value has an unexpected type", path, expected, node.kind(),
+                     node);
+    }
+}
+
+template <typename T>
+[[nodiscard]] auto decodeDocument(const Document& document, StringPool* pool) -> Result<T> {
+    FASTOML_CPP_INSTRUMENT(Operation::Decode, 0u);
+
+    auto rootNode = document.root();
+    if (!rootNode) {
+        return makeUnexpected<T>(rootNode.error());
+    }
+    return decodeNode<Decayed<T>>(*rootNode, pool);
+}
+
+template <typename T>
+[[nodiscard]] auto checkDocument(const Document& document, SchemaMode mode)
+    -> Result<std::vector<SchemaViolation>> {
+    auto rootNode = document.root();
+    if (!rootNode) {
+        return makeUnexpected<std::vector<SchemaViolation>>(rootNode.error());
+    }
+
+    std::vector<SchemaViolation> violations;
+    std::string path;
+    checkNode<Decayed<T>>(*rootNode, path, violations, mode);
+    return violations;
+}
+
 } // namespace detail
 
 template <typename T>
 [[nodiscard]] auto decode(const Document& document) -> Result<T>
     requires ModelDefined<std::remove_cv_t<std::remove_reference_t<T>>>
 {
+    return detail::decodeDocument<std::remove_cv_t<std::remove_reference_t<T>>>(document, nullptr);
+}
+
+template <typename T>
+[[nodiscard]] auto decode(const Document& document, StringPool& pool) -> Result<T>
+    requires ModelDefined<std::remove_cv_t<std::remove_reference_t<T>>>
+{
+    return detail::decodeDocument<std::remove_cv_t<std::remove_reference_t<T>>>(document, &pool);
+}
+
+template <typename T>
+[[nodiscard]] auto decodeInto(const Document& document, T& target) -> Result<FieldChanges<T>>
+    requires ModelDefined<T>
+{
+    FASTOML_CPP_INSTRUMENT(Operation::Decode, 0u);
+
     auto rootNode = document.root();
     if (!rootNode) {
-        return makeUnexpected<T>(rootNode.error());
+        return makeUnexpected<FieldChanges<T>>(rootNode.error());
+    }
+
+    FieldChanges<T> changes;
+    auto status = detail::decodeObjectInto(*rootNode, target, changes);
+    if (!status) {
+        return makeUnexpected<FieldChanges<T>>(status.error());
+    }
+    return changes;
+}
+
+template <typename T>
+[[nodiscard]] auto checkSchema(const Document& document, SchemaMode mode = SchemaMode::Owned)
+    -> Result<std::vector<SchemaViolation>>
+    requires ModelDefined<std::remove_cv_t<std::remove_reference_t<T>>>
+{
+    return detail::checkDocument<T>(document, mode);
+}
+
+template <typename T>
+class Borrowed {
+public:
+    Borrowed(Document document, T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : document_(std::move(document)), value_(std::move(value)) {
+    }
+
+    [[nodiscard]] auto value() const noexcept -> const T& {
+        return value_;
+    }
+
+    [[nodiscard]] auto document() const noexcept -> const Document& {
+        return document_;
+    }
+
+    [[nodiscard]] auto operator*() const noexcept -> const T& {
+        return value_;
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> const T* {
+        return &value_;
+    }
+
+private:
+    Document document_;
+    T value_;
+};
+
+template <typename T>
+[[nodiscard]] auto decodeBorrowed(Document document) -> Result<Borrowed<T>>
+    requires ModelDefined<T>
+{
+    FASTOML_CPP_INSTRUMENT(Operation::Decode, 0u);
+
+    auto rootNode = document.root();
+    if (!rootNode) {
+        return makeUnexpected<Borrowed<T>>(rootNode.error());
+    }
+
+    auto value = detail::decodeNode<T, detail::DecodeMode::Borrowed>(*rootNode);
+    if (!value) {
+        return makeUnexpected<Borrowed<T>>(value.error());
     }
-    return detail::decodeNode<std::remove_cv_t<std::remove_reference_t<T>>>(*rootNode);
+    return Borrowed<T>(std::move(document), std::move(*value));
+}
+
+template <typename T>
+[[nodiscard]] auto parseBorrowed(std::string_view toml, ParseOptions options = {}) -> Result<Borrowed<T>>
+    requires ModelDefined<T>
+{
+    auto document = parse(toml, options);
+    if (!document) {
+        return makeUnexpected<Borrowed<T>>(document.error());
+    }
+    return decodeBorrowed<T>(std::move(*document));
 }
 
 template <typename T>
@@ -208,6 +809,17 @@ template <typename T>
     return decode<std::remove_cv_t<std::remove_reference_t<T>>>(*document);
 }
 
+template <typename T>
+[[nodiscard]] auto parseAs(std::string_view toml, StringPool& pool, ParseOptions options = {}) -> Result<T>
+    requires ModelDefined<std::remove_cv_t<std::remove_reference_t<T>>>
+{
+    auto document = parse(toml, options);
+    if (!document) {
+        return makeUnexpected<T>(document.error());
+    }
+    return decode<std::remove_cv_t<std::remove_reference_t<T>>>(*document, pool);
+}
+
 template <typename T>
 [[nodiscard]] auto toToml(const T& source, SerializeOptions options = {}) -> Result<std::string>
     requires ModelDefined<std::remove_cv_t<std::remove_reference_t<T>>>
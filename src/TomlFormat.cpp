@@ -0,0 +1,134 @@
+#include "detail/TomlFormat.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+
+namespace Fastoml::detail {
+
+namespace {
+
+constexpr std::size_t escapeScanBlock = 16u;
+
+constexpr auto needsEscape(unsigned char c) noexcept -> bool {
+    return c < 0x20u || c == 0x7Fu || c == '"' || c == '\\';
+}
+
+// Tests a whole block before looking for the exact position, so long runs of plain text stay branch-light.
+auto findEscape(std::string_view text, std::size_t from) noexcept -> std::size_t {
+    const auto* data = reinterpret_cast<const unsigned char*>(text.data());
+    auto i = from;
+    while (i + escapeScanBlock <= text.size()) {
+        bool found = false;
+        for (std::size_t j = 0u; j < escapeScanBlock; ++j) {
+            found |= needsEscape(data[i + j]);
+        }
+        if (found) {
+            break;
+        }
+        i += escapeScanBlock;
+    }
+    for (; i < text.size(); ++i) {
+        if (needsEscape(data[i])) {
+            return i;
+        }
+    }
+    return text.size();
+}
+
+constexpr auto isBareKeyChar(char c) noexcept -> bool {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-';
+}
+
+} // namespace
+
+auto appendQuotedString(std::string& output, std::string_view text) -> void {
+    constexpr std::string_view hexDigits = "0123456789ABCDEF";
+
+    output += '"';
+    std::size_t runStart = 0u;
+    while (runStart < text.size()) {
+        const auto escape = findEscape(text, runStart);
+        output.append(text.data() + runStart, escape - runStart);
+        if (escape == text.size()) {
+            break;
+        }
+
+        const auto c = static_cast<unsigned char>(text[escape]);
+        switch (c) {
+        case '"':
+            output += "\\\"";
+            break;
+        case '\\':
+            output += "\\\\";
+            break;
+        case '\n':
+            output += "\\n";
+            break;
+        case '\r':
+            output += "\\r";
+            break;
+        case '\t':
+            output += "\\t";
+            break;
+        case '\b':
+            output += "\\b";
+            break;
+        case '\f':
+            output += "\\f";
+            break;
+        default:
+            output += "\\u00";
+            output += hexDigits[c >> 4u];
+            output += hexDigits[c & 0x0Fu];
+            break;
+        }
+        runStart = escape + 1u;
+    }
+    output += '"';
+}
+
+auto appendTomlString(std::string& output, std::string_view text) -> void {
+    appendQuotedString(output, text);
+}
+
+auto appendTomlKey(std::string& output, std::string_view key) -> void {
+    bool bare = !key.empty();
+    for (const auto c : key) {
+        bare = bare && isBareKeyChar(c);
+    }
+
+    if (bare) {
+        output += key;
+    } else {
+        appendTomlString(output, key);
+    }
+}
+
+auto appendTomlInt(std::string& output, std::int64_t value) -> void {
+    std::array<char, 24> buffer{};
+    const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    output.append(buffer.data(), result.ptr);
+}
+
+auto appendTomlFloat(std::string& output, double value) -> void {
+    if (std::isnan(value)) {
+        output += "nan";
+        return;
+    }
+    if (std::isinf(value)) {
+        output += value < 0.0 ? "-inf" : "inf";
+        return;
+    }
+
+    std::array<char, 32> buffer{};
+    const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    const std::string_view text(buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+    output += text;
+    if (text.find_first_of(".eE") == std::string_view::npos) {
+        output += ".0";
+    }
+}
+
+} // namespace Fastoml::detail
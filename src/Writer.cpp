@@ -0,0 +1,338 @@
+#include "Writer.hpp"
+
+#include "detail/PathParser.hpp"
+#include "detail/TomlFormat.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Fastoml {
+
+Writer::Writer(std::string& output, WriterOptions options)
+    : options_(options), sink_(SinkKind::String), output_(&output), outputStart_(output.size()) {
+}
+
+Writer::Writer(std::span<char> buffer, WriterOptions options)
+    : options_(options), sink_(SinkKind::Buffer), buffer_(buffer) {
+}
+
+Writer::Writer(std::FILE* file, WriterOptions options) : options_(options), sink_(SinkKind::File), file_(file) {
+    if (file_ == nullptr) {
+        fail(ErrorCode::InvalidState, "Writer requires a non-null file.");
+    }
+}
+
+Writer::~Writer() {
+    static_cast<void>(flush());
+}
+
+auto Writer::beginTable(std::string_view dotPath) -> Writer& {
+    return header(dotPath, HeaderKind::Table);
+}
+
+auto Writer::beginArrayOfTables(std::string_view dotPath) -> Writer& {
+    return header(dotPath, HeaderKind::ArrayOfTables);
+}
+
+auto Writer::key(std::string_view key) -> Writer& {
+    if (!usable()) {
+        return *this;
+    }
+    if (pendingKey_) {
+        return fail(ErrorCode::InvalidState, "Key written before the previous key received a value.", key);
+    }
+
+    if (!frames_.empty()) {
+        auto& frame = frames_.back();
+        if (frame.kind == FrameKind::Array) {
+            return fail(ErrorCode::InvalidState, "Keys cannot be written directly inside an array.", key);
+        }
+        if (!frame.keys.emplace(key).second) {
+            return fail(ErrorCode::DuplicateKey, "Key written twice in the same table.", key);
+        }
+    } else {
+        const auto [entry, inserted] = table_->entries.try_emplace(std::string(key));
+        if (!inserted) {
+            return entry->second.kind == EntryKind::Value
+                       ? fail(ErrorCode::DuplicateKey, "Key written twice in the same table.", key)
+                       : fail(ErrorCode::Type, "Key conflicts with an earlier table header.", key);
+        }
+    }
+
+    auto& output = out();
+    if (!frames_.empty()) {
+        output += frames_.back().count++ == 0u ? " " : ", ";
+    }
+    detail::appendTomlKey(output, key);
+    output += " = ";
+    pendingKey_ = true;
+    return *this;
+}
+
+auto Writer::value(bool value) -> Writer& {
+    if (beginValue()) {
+        out() += value ? "true" : "false";
+        endValue();
+    }
+    return *this;
+}
+
+auto Writer::value(std::int64_t value) -> Writer& {
+    if (beginValue()) {
+        detail::appendTomlInt(out(), value);
+        endValue();
+    }
+    return *this;
+}
+
+auto Writer::value(double value) -> Writer& {
+    if (beginValue()) {
+        detail::appendTomlFloat(out(), value);
+        endValue();
+    }
+    return *this;
+}
+
+auto Writer::value(std::string_view value) -> Writer& {
+    if (beginValue()) {
+        detail::appendTomlString(out(), value);
+        endValue();
+    }
+    return *this;
+}
+
+auto Writer::value(const char* value) -> Writer& {
+    if (value == nullptr) {
+        return fail(ErrorCode::InvalidState, "Cannot write a null string value.");
+    }
+    return this->value(std::string_view(value));
+}
+
+auto Writer::beginArray() -> Writer& {
+    if (beginValue()) {
+        out() += '[';
+        frames_.emplace_back().kind = FrameKind::Array;
+    }
+    return *this;
+}
+
+auto Writer::endArray() -> Writer& {
+    if (!usable()) {
+        return *this;
+    }
+    if (frames_.empty() || frames_.back().kind != FrameKind::Array) {
+        return fail(ErrorCode::InvalidState, "endArray() called without a matching beginArray().");
+    }
+
+    frames_.pop_back();
+    out() += ']';
+    endValue();
+    return *this;
+}
+
+auto Writer::beginInlineTable() -> Writer& {
+    if (beginValue()) {
+        out() += '{';
+        frames_.emplace_back().kind = FrameKind::InlineTable;
+    }
+    return *this;
+}
+
+auto Writer::endInlineTable() -> Writer& {
+    if (!usable()) {
+        return *this;
+    }
+    if (frames_.empty() || frames_.back().kind != FrameKind::InlineTable) {
+        return fail(ErrorCode::InvalidState, "endInlineTable() called without a matching beginInlineTable().");
+    }
+    if (pendingKey_) {
+        return fail(ErrorCode::InvalidState, "Inline table closed while a key is waiting for a value.");
+    }
+
+    const auto count = frames_.back().count;
+    frames_.pop_back();
+    out() += count == 0u ? "}" : " }";
+    endValue();
+    return *this;
+}
+
+auto Writer::ok() const noexcept -> bool {
+    return !failed_;
+}
+
+auto Writer::bytesWritten() const noexcept -> std::size_t {
+    if (sink_ == SinkKind::String) {
+        return output_->size() - outputStart_;
+    }
+    return flushed_ + scratch_.size();
+}
+
+auto Writer::finish() -> Result<std::size_t> {
+    if (usable() && (pendingKey_ || !frames_.empty())) {
+        fail(ErrorCode::InvalidState, "Writer finished with an open key, array or inline table.");
+    }
+    if (!failed_ && !flush()) {
+        failFlush();
+    }
+    if (!failed_ && sink_ == SinkKind::File && std::fflush(file_) != 0) {
+        fail(ErrorCode::Io, "Failed to flush TOML output file.");
+    }
+    if (failed_) {
+        return makeUnexpected<std::size_t>(error_);
+    }
+
+    finished_ = true;
+    return bytesWritten();
+}
+
+auto Writer::out() noexcept -> std::string& {
+    return sink_ == SinkKind::String ? *output_ : scratch_;
+}
+
+auto Writer::fail(ErrorCode code, const char* summary, std::string_view key) -> Writer& {
+    if (!failed_) {
+        failed_ = true;
+        error_ = keyError(code, summary, key);
+    }
+    return *this;
+}
+
+auto Writer::failFlush() -> void {
+    if (sink_ == SinkKind::Buffer) {
+        fail(ErrorCode::Overflow, "Writer buffer is too small for the TOML output.");
+    } else {
+        fail(ErrorCode::Io, "Failed to write TOML output.");
+    }
+}
+
+auto Writer::usable() -> bool {
+    if (failed_) {
+        return false;
+    }
+    if (finished_) {
+        fail(ErrorCode::InvalidState, "Writer used after finish().");
+        return false;
+    }
+    return true;
+}
+
+auto Writer::beginValue() -> bool {
+    if (!usable()) {
+        return false;
+    }
+
+    if (!frames_.empty() && frames_.back().kind == FrameKind::Array) {
+        if (frames_.back().count++ != 0u) {
+            out() += ", ";
+        }
+        return true;
+    }
+    if (!pendingKey_) {
+        fail(ErrorCode::InvalidState, "Value written without a key.");
+        return false;
+    }
+
+    pendingKey_ = false;
+    return true;
+}
+
+auto Writer::endValue() -> void {
+    if (!frames_.empty()) {
+        return;
+    }
+
+    out() += '\n';
+    if (sink_ != SinkKind::String && scratch_.size() >= writerFlushBytes && !flush()) {
+        failFlush();
+    }
+}
+
+auto Writer::header(std::string_view dotPath, HeaderKind kind) -> Writer& {
+    if (!usable()) {
+        return *this;
+    }
+    if (pendingKey_ || !frames_.empty()) {
+        return fail(ErrorCode::InvalidState, "Table header written inside an open value.", dotPath);
+    }
+
+    detail::DotPathCursor cursor(dotPath);
+    while (!cursor.done()) {
+        if (cursor.next().empty()) {
+            return fail(ErrorCode::InvalidPath, "Table header path contains an empty segment.", dotPath);
+        }
+    }
+
+    auto* scope = &root_;
+    cursor = detail::DotPathCursor(dotPath);
+    while (!cursor.done()) {
+        const auto segment = cursor.next();
+        const auto last = cursor.done();
+        const auto [position, inserted] = scope->entries.try_emplace(std::string(segment));
+        auto& entry = position->second;
+        if (inserted) {
+            entry.kind = EntryKind::ImplicitTable;
+            if (last) {
+                entry.kind = kind == HeaderKind::Table ? EntryKind::Table : EntryKind::ArrayOfTables;
+            }
+            entry.scope = std::make_unique<Scope>();
+        } else if (entry.kind == EntryKind::Value) {
+            return fail(ErrorCode::Type, "Table header conflicts with an earlier key.", dotPath);
+        } else if (last && kind == HeaderKind::Table) {
+            if (entry.kind != EntryKind::ImplicitTable) {
+                return fail(entry.kind == EntryKind::Table ? ErrorCode::DuplicateKey : ErrorCode::Type,
+                            "Table header conflicts with an earlier header.", dotPath);
+            }
+            entry.kind = EntryKind::Table;
+        } else if (last) {
+            if (entry.kind != EntryKind::ArrayOfTables) {
+                return fail(ErrorCode::Type, "Table header conflicts with an earlier header.", dotPath);
+            }
+            // A new element starts a fresh scope, so sub-tables of the previous element may be reopened.
+            entry.scope->entries.clear();
+        }
+        scope = entry.scope.get();
+    }
+    if (!options_.retainClosedKeys && table_ != scope) {
+        std::erase_if(table_->entries, [](const auto& entry) { return entry.second.kind == EntryKind::Value; });
+    }
+    table_ = scope;
+
+    auto& output = out();
+    if (bytesWritten() != 0u) {
+        output += '\n';
+    }
+    output += kind == HeaderKind::Table ? "[" : "[[";
+    cursor = detail::DotPathCursor(dotPath);
+    for (bool first = true; !cursor.done(); first = false) {
+        if (!first) {
+            output += '.';
+        }
+        detail::appendTomlKey(output, cursor.next());
+    }
+    output += kind == HeaderKind::Table ? "]\n" : "]]\n";
+    return *this;
+}
+
+auto Writer::flush() noexcept -> bool {
+    if (scratch_.empty()) {
+        return true;
+    }
+
+    if (sink_ == SinkKind::Buffer) {
+        if (scratch_.size() > buffer_.size() - bufferUsed_) {
+            return false;
+        }
+        std::memcpy(buffer_.data() + bufferUsed_, scratch_.data(), scratch_.size());
+        bufferUsed_ += scratch_.size();
+    } else if (sink_ == SinkKind::File) {
+        if (file_ == nullptr || std::fwrite(scratch_.data(), 1u, scratch_.size(), file_) != scratch_.size()) {
+            return false;
+        }
+    }
+
+    flushed_ += scratch_.size();
+    scratch_.clear();
+    return true;
+}
+
+} // namespace Fastoml
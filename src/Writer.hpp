@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Error.hpp"
+#include "Options.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Fastoml {
+
+inline constexpr std::size_t writerFlushBytes = 64u * 1024u;
+
+class Writer {
+public:
+    explicit Writer(std::string& output, WriterOptions options = {});
+    explicit Writer(std::span<char> buffer, WriterOptions options = {});
+    explicit Writer(std::FILE* file, WriterOptions options = {});
+    ~Writer();
+
+    Writer(const Writer&) = delete;
+    auto operator=(const Writer&) -> Writer& = delete;
+    Writer(Writer&&) = delete;
+    auto operator=(Writer&&) -> Writer& = delete;
+
+    auto beginTable(std::string_view dotPath) -> Writer&;
+    auto beginArrayOfTables(std::string_view dotPath) -> Writer&;
+
+    auto key(std::string_view key) -> Writer&;
+
+    auto value(bool value) -> Writer&;
+    auto value(std::int64_t value) -> Writer&;
+    auto value(double value) -> Writer&;
+    auto value(std::string_view value) -> Writer&;
+    auto value(const char* value) -> Writer&;
+
+    template <typename T>
+    auto value(T value) -> Writer&
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, std::int64_t>)
+    {
+        if constexpr (std::is_unsigned_v<T>) {
+            if (value > static_cast<T>((std::numeric_limits<std::int64_t>::max)())) {
+                return fail(ErrorCode::Overflow, "Unsigned integer conversion overflow while writing value.");
+            }
+        }
+        return this->value(static_cast<std::int64_t>(value));
+    }
+
+    auto beginArray() -> Writer&;
+    auto endArray() -> Writer&;
+    auto beginInlineTable() -> Writer&;
+    auto endInlineTable() -> Writer&;
+
+    [[nodiscard]] auto ok() const noexcept -> bool;
+    [[nodiscard]] auto bytesWritten() const noexcept -> std::size_t;
+    [[nodiscard]] auto finish() -> Result<std::size_t>;
+
+private:
+    enum class SinkKind : std::uint8_t {
+        String,
+        Buffer,
+        File,
+    };
+
+    enum class FrameKind : std::uint8_t {
+        Array,
+        InlineTable,
+    };
+
+    enum class HeaderKind : std::uint8_t {
+        Table,
+        ArrayOfTables,
+    };
+
+    enum class EntryKind : std::uint8_t {
+        Value,
+        ImplicitTable,
+        Table,
+        ArrayOfTables,
+    };
+
+    struct Frame {
+        FrameKind kind = FrameKind::Array;
+        std::size_t count = 0u;
+        std::unordered_set<std::string> keys;
+    };
+
+    struct Scope;
+
+    struct Entry {
+        EntryKind kind = EntryKind::Value;
+        std::unique_ptr<Scope> scope;
+    };
+
+    // For an array of tables, `entries` holds only the element currently being written. Value entries are dropped
+    // when the table is left unless WriterOptions::retainClosedKeys is set; header entries are always kept.
+    struct Scope {
+        std::unordered_map<std::string, Entry> entries;
+    };
+
+    WriterOptions options_;
+    SinkKind sink_ = SinkKind::String;
+    std::string* output_ = nullptr;
+    std::size_t outputStart_ = 0u;
+    std::span<char> buffer_;
+    std::size_t bufferUsed_ = 0u;
+    std::FILE* file_ = nullptr;
+    std::size_t flushed_ = 0u;
+    std::string scratch_;
+
+    std::vector<Frame> frames_;
+    Scope root_;
+    Scope* table_ = &root_;
+    bool pendingKey_ = false;
+    bool finished_ = false;
+    bool failed_ = false;
+    Error error_;
+
+    [[nodiscard]] auto out() noexcept -> std::string&;
+    auto fail(ErrorCode code, const char* summary, std::string_view key = {}) -> Writer&;
+    auto failFlush() -> void;
+    [[nodiscard]] auto usable() -> bool;
+    [[nodiscard]] auto beginValue() -> bool;
+    auto endValue() -> void;
+    auto header(std::string_view dotPath, HeaderKind kind) -> Writer&;
+    auto flush() noexcept -> bool;
+};
+
+} // namespace Fastoml
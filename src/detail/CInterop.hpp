@@ -5,17 +5,24 @@
 
 #include <fastoml.h>
 
+#include <memory_resource>
 #include <string_view>
 
 namespace Fastoml::detail {
 
 [[nodiscard]] auto toErrorCode(fastoml_status status) -> ErrorCode;
-[[nodiscard]] auto toError(fastoml_status status, const fastoml_error* error, std::string_view context) -> Error;
+[[nodiscard]] auto toError(fastoml_status status, const fastoml_error* error, const char* context) -> Error;
 
+[[nodiscard]] auto toFastomlAllocator(std::pmr::memory_resource* resource) -> fastoml_allocator;
 [[nodiscard]] auto toFastomlOptions(const ParseOptions& options) -> fastoml_options;
 [[nodiscard]] auto toFastomlBuilderOptions(const BuilderOptions& options) -> fastoml_builder_options;
 [[nodiscard]] auto toFastomlSerializeOptions(const SerializeOptions& options) -> fastoml_serialize_options;
 
 [[nodiscard]] auto toSlice(std::string_view value) -> Result<fastoml_slice>;
+[[nodiscard]] auto checkSourceSize(std::string_view source) -> Result<void>;
+[[nodiscard]] auto nodeSource(const fastoml_node* node) noexcept -> std::string_view;
+// Source of an inline table or static array, which is one contiguous span; empty for `[table]` sections and arrays of
+// tables, whose contents can be spread across the file.
+[[nodiscard]] auto inlineNodeSource(const fastoml_node* node) noexcept -> std::string_view;
 
 } // namespace Fastoml::detail
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace Fastoml::detail {
+
+// 64-bit FNV-1a; constexpr so enum name tables can hash at compile time.
+[[nodiscard]] constexpr auto nameHash(std::string_view text) noexcept -> std::uint64_t {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (const auto c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace Fastoml::detail
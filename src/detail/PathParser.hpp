@@ -2,11 +2,34 @@
 
 #include "Error.hpp"
 
+#include <cstddef>
 #include <string_view>
 #include <vector>
 
 namespace Fastoml::detail {
 
+class DotPathCursor {
+public:
+    explicit DotPathCursor(std::string_view path) noexcept : path_(path) {
+    }
+
+    [[nodiscard]] auto done() const noexcept -> bool {
+        return offset_ > path_.size();
+    }
+
+    [[nodiscard]] auto next() noexcept -> std::string_view {
+        const auto end = path_.find('.', offset_);
+        const auto count = (end == std::string_view::npos) ? path_.size() - offset_ : end - offset_;
+        const auto segment = path_.substr(offset_, count);
+        offset_ = (end == std::string_view::npos) ? path_.size() + 1u : end + 1u;
+        return segment;
+    }
+
+private:
+    std::string_view path_;
+    std::size_t offset_ = 0u;
+};
+
 [[nodiscard]] auto splitDotPath(std::string_view path) -> Result<std::vector<std::string_view>>;
 
 } // namespace Fastoml::detail
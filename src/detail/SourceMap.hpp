@@ -0,0 +1,33 @@
+#pragma once
+
+#include "NodeView.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Fastoml::detail {
+
+class SourceMap {
+public:
+    SourceMap() = default;
+
+    SourceMap(const SourceMap&) = delete;
+    auto operator=(const SourceMap&) -> SourceMap& = delete;
+
+    auto setSource(std::string_view source) noexcept -> void;
+    [[nodiscard]] auto locate(std::string_view span) const -> std::optional<SourceLocation>;
+
+private:
+    std::string_view source_;
+    mutable std::mutex indexMutex_;
+    mutable std::atomic<bool> indexed_{false};
+    mutable std::vector<std::uint32_t> lineStarts_;
+
+    auto buildIndex() const -> void;
+};
+
+} // namespace Fastoml::detail
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Fastoml::detail {
+
+// Double-quoted string using only escapes that are valid in both TOML basic strings and JSON.
+auto appendQuotedString(std::string& output, std::string_view text) -> void;
+auto appendTomlString(std::string& output, std::string_view text) -> void;
+auto appendTomlKey(std::string& output, std::string_view key) -> void;
+auto appendTomlInt(std::string& output, std::int64_t value) -> void;
+auto appendTomlFloat(std::string& output, double value) -> void;
+
+} // namespace Fastoml::detail